@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 任务取消测试: 队列中已有N个任务时取消其中一个, 比较按函数指针扫描队列的cancelTask()与句柄的O(1)取消
+// 用法: bench_cancel
+
+#include <functional>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr int kCancels = 200;
+
+void queuedTask(void *) { bench::spinWork(10); }
+
+void targetTask(void *) { bench::spinWork(10); }
+
+// 返回每次取消的平均耗时(ns)
+double measure(size_t queued, bool handle) {
+    OSALThreadPool pool;
+    pool.start(1, 0, 0);
+    pool.suspend();
+    for (size_t i = 0; i < queued; ++i) {
+        pool.submit(queuedTask, nullptr, 0);
+    }
+    std::function<void(void *)> target = targetTask;
+    std::vector<OSALTaskHandle> handles;
+    handles.reserve(kCancels);
+    uint64_t elapsed = 0;
+    for (int i = 0; i < kCancels; ++i) {
+        if (handle) {
+            handles.push_back(pool.submitCancellable([]() { targetTask(nullptr); }));
+            uint64_t begin = bench::nowNs();
+            pool.cancel(handles.back());
+            elapsed += bench::nowNs() - begin;
+        } else {
+            pool.submit(target, nullptr, 0);
+            uint64_t begin = bench::nowNs();
+            pool.cancelTask(target);
+            elapsed += bench::nowNs() - begin;
+        }
+    }
+    pool.resume();
+    pool.stop();
+    return static_cast<double>(elapsed) / kCancels;
+}
+
+}  // namespace
+
+int main() {
+    OSAL_LOGI("%-10s %-22s %s\n", "queued", "cancelTask(ns/op)", "handle cancel(ns/op)");
+    for (size_t queued : {100u, 1000u, 10000u, 100000u}) {
+        OSAL_LOGI("%-10zu %-22.0f %.0f\n", queued, measure(queued, false), measure(queued, true));
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// 协程测试: 两个执行流通过信号量来回交替(乒乓), 比较两个线程阻塞在OSALSemaphore上与两个协程挂起在OSALAsyncSemaphore上
+// 输出每次往返的平均耗时
+// 用法: bench_coroutine
+
+#include "benchmark_common.h"
+#include "osal_coroutine.h"
+#include "osal_semaphore.h"
+#include "osal_thread.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr uint32_t kRounds = 20000;
+
+double measureThreads() {
+    OSALSemaphore ping;
+    OSALSemaphore pong;
+    OSALThread thread;
+    thread.start("PingPong", [&ping, &pong](void *) {
+        for (uint32_t i = 0; i < kRounds; ++i) {
+            ping.wait();
+            pong.signal();
+        }
+    }, nullptr);
+    uint64_t begin = bench::nowNs();
+    for (uint32_t i = 0; i < kRounds; ++i) {
+        ping.signal();
+        pong.wait();
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    thread.join();
+    return static_cast<double>(elapsed) / kRounds;
+}
+
+#if OSAL_CONFIG_COROUTINE
+OSALTask<> responder(OSALAsyncSemaphore &ping, OSALAsyncSemaphore &pong) {
+    for (uint32_t i = 0; i < kRounds; ++i) {
+        co_await ping.acquire();
+        pong.release();
+    }
+}
+
+OSALTask<> initiator(OSALAsyncSemaphore &ping, OSALAsyncSemaphore &pong) {
+    for (uint32_t i = 0; i < kRounds; ++i) {
+        ping.release();
+        co_await pong.acquire();
+    }
+}
+
+double measureCoroutines() {
+    OSALAsyncSemaphore ping(0);
+    OSALAsyncSemaphore pong(0);
+    OSALFuture<void> responded = spawn(responder(ping, pong));
+    uint64_t begin = bench::nowNs();
+    syncWait(initiator(ping, pong));
+    uint64_t elapsed = bench::nowNs() - begin;
+    responded.wait();
+    return static_cast<double>(elapsed) / kRounds;
+}
+#endif
+
+}  // namespace
+
+int main() {
+    OSAL_LOGI("%-20s %.1f ns/round\n", "thread+semaphore", measureThreads());
+#if OSAL_CONFIG_COROUTINE
+    OSAL_LOGI("%-20s %.1f ns/round\n", "coroutine", measureCoroutines());
+#endif
+    return 0;
+}
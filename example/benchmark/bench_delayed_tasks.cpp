@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// 延时任务测试: 同时安排N个一次性延时任务, 比较每个任务一个OSALTimer(POSIX上每个定时器一个线程)与线程池的submitAfter()
+// 输出安排N个任务的总耗时和任务实际执行时间相对截止时间的平均延迟
+// 用法: bench_delayed_tasks
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_chrono.h"
+#include "osal_system.h"
+#include "osal_thread_pool.h"
+#include "osal_timer.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr uint32_t kDelayMs = 50;
+
+struct Result {
+    double scheduleMs;  // 安排所有任务的耗时
+    double lateMs;      // 实际执行时间相对截止时间的平均延迟
+};
+
+struct Tracker {
+    std::atomic<size_t> fired{0};
+    std::atomic<uint64_t> lateMs{0};
+
+    void record(OSALChrono::TimePoint deadline) {
+        OSALChrono::TimePoint now = OSALChrono::getInstance().now();
+        lateMs += static_cast<int32_t>(now - deadline) > 0 ? now - deadline : 0;
+        ++fired;
+    }
+
+    Result wait(size_t count, uint64_t scheduleNs) {
+        while (fired < count) {
+            OSALSystem::getInstance().sleep_ms(1);
+        }
+        return Result{scheduleNs / 1e6, static_cast<double>(lateMs) / count};
+    }
+};
+
+Result measureTimers(size_t count) {
+    Tracker tracker;
+    std::vector<std::unique_ptr<OSALTimer>> timers;
+    timers.reserve(count);
+    uint64_t begin = bench::nowNs();
+    for (size_t i = 0; i < count; ++i) {
+        OSALChrono::TimePoint deadline = OSALChrono::getInstance().now() + kDelayMs;
+        timers.push_back(std::make_unique<OSALTimer>());
+        timers.back()->start(kDelayMs, false, [&tracker, deadline]() { tracker.record(deadline); });
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    Result result = tracker.wait(count, elapsed);
+    timers.clear();
+    return result;
+}
+
+Result measurePool(size_t count) {
+    Tracker tracker;
+    OSALThreadPool pool;
+    pool.start(2, 0, 0);
+    uint64_t begin = bench::nowNs();
+    for (size_t i = 0; i < count; ++i) {
+        OSALChrono::TimePoint deadline = OSALChrono::getInstance().now() + kDelayMs;
+        pool.submitAt(deadline, [&tracker, deadline]() { tracker.record(deadline); });
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    Result result = tracker.wait(count, elapsed);
+    pool.stop();
+    return result;
+}
+
+}  // namespace
+
+int main() {
+    OSAL_LOGI("%-8s %-20s %-20s %-20s %s\n", "tasks", "timer schedule(ms)", "timer late(ms)", "pool schedule(ms)",
+              "pool late(ms)");
+    for (size_t count : {100u, 1000u, 2000u}) {
+        Result timers = measureTimers(count);
+        Result pool = measurePool(count);
+        OSAL_LOGI("%-8zu %-20.2f %-20.2f %-20.2f %.2f\n", count, timers.scheduleMs, timers.lateMs, pool.scheduleMs,
+                  pool.lateMs);
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// 派发延迟测试: 空闲线程池每隔一段时间提交一个任务, 测量从提交到任务开始执行的耗时
+// 比较空闲线程直接休眠、自旋后休眠、自旋+让出CPU后休眠、保留一个热线程四种等待策略
+// 用法: bench_dispatch_latency [采样次数]
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr uint32_t kIntervalUs = 200;  // 两次提交之间的间隔, 保证每次提交时线程池都已空闲
+
+struct Mode {
+    const char *name;
+    ThreadPoolSpinPolicy policy;
+};
+
+struct Result {
+    double averageUs;
+    double p50Us;
+    double p99Us;
+};
+
+Result measure(const ThreadPoolSpinPolicy &policy, size_t samples) {
+    OSALThreadPool pool;
+    pool.setSpinPolicy(policy);
+    pool.start(2, 0, 0);
+    std::vector<uint64_t> latencies(samples);
+    std::atomic<size_t> done{0};
+    for (size_t i = 0; i < samples; ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(kIntervalUs));
+        uint64_t submitted = bench::nowNs();
+        pool.post([&latencies, &done, submitted, i]() {
+            latencies[i] = bench::nowNs() - submitted;
+            ++done;
+        });
+        while (done <= i) {
+            std::this_thread::yield();
+        }
+    }
+    pool.stop();
+    std::sort(latencies.begin(), latencies.end());
+    uint64_t total = 0;
+    for (uint64_t latency : latencies) {
+        total += latency;
+    }
+    return Result{total / 1e3 / samples, latencies[samples / 2] / 1e3, latencies[samples * 99 / 100] / 1e3};
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    size_t samples = argc > 1 ? static_cast<size_t>(std::max(1, std::atoi(argv[1]))) : 2000;
+    const Mode modes[] = {
+        {"park", ThreadPoolSpinPolicy{0, 0, 0}},
+        {"spin", ThreadPoolSpinPolicy{20000, 0, 0}},
+        {"spin+yield", ThreadPoolSpinPolicy{2000, 200, 0}},
+        {"hot", ThreadPoolSpinPolicy{2000, 0, 1}},
+    };
+    OSAL_LOGI("%-12s %-14s %-14s %s\n", "mode", "avg(us)", "p50(us)", "p99(us)");
+    for (const Mode &mode : modes) {
+        Result result = measure(mode.policy, samples);
+        OSAL_LOGI("%-12s %-14.2f %-14.2f %.2f\n", mode.name, result.averageUs, result.p50Us, result.p99Us);
+    }
+    return 0;
+}
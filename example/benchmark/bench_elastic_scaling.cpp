@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 弹性伸缩测试: 突发的阻塞任务之间穿插空闲期, 比较固定大小线程池与按需扩容/空闲收缩线程池的
+// 突发完成时间和空闲期常驻线程数
+// 用法: bench_elastic_scaling [最大线程数]
+
+#include <atomic>
+
+#include "benchmark_common.h"
+#include "osal_semaphore.h"
+#include "osal_system.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr int kBursts = 5;
+constexpr uint32_t kBlockMs = 20;
+constexpr uint32_t kIdleGapMs = 200;
+constexpr uint32_t kIdleTimeoutMs = 50;
+
+struct Context {
+    std::atomic<int> remaining;
+    OSALSemaphore done;
+};
+
+void blockingTask(void *arg) {
+    auto *ctx = static_cast<Context *>(arg);
+    OSALSystem::getInstance().sleep_ms(kBlockMs);
+    if (ctx->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        ctx->done.signal();
+    }
+}
+
+struct Result {
+    double burstMs;         // 平均每次突发的完成时间
+    uint32_t idleThreads;  // 空闲期结束时的常驻线程数
+    ThreadPoolScalingStats stats;
+};
+
+Result measure(uint32_t maxThreads, bool elastic) {
+    OSALThreadPool pool;
+    if (elastic) {
+        pool.start(1, 0, 0);
+        pool.setMaxThreads(maxThreads);
+        pool.setIdleTimeout(kIdleTimeoutMs);
+        pool.setGrowThreshold(1, 0);
+    } else {
+        pool.start(maxThreads, 0, 0);
+    }
+
+    uint64_t total = 0;
+    uint32_t idleThreads = 0;
+    for (int burst = 0; burst < kBursts; ++burst) {
+        Context ctx{{static_cast<int>(maxThreads)}, {}};
+        uint64_t begin = bench::nowNs();
+        for (uint32_t i = 0; i < maxThreads; ++i) {
+            pool.submit(blockingTask, &ctx, 0);
+        }
+        ctx.done.wait();
+        total += bench::nowNs() - begin;
+        OSALSystem::getInstance().sleep_ms(kIdleGapMs);
+        idleThreads = pool.getScalingStats().currentThreads;
+    }
+    Result result{total / 1e6 / kBursts, idleThreads, pool.getScalingStats()};
+    pool.stop();
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSAL_LOGI("%-8s %-10s %-12s %-14s %-8s %-10s %s\n", "threads", "mode", "burst(ms)", "idle threads", "peak",
+              "created", "retired");
+    for (uint32_t threads : bench::threadSweep(maxThreads)) {
+        for (bool elastic : {false, true}) {
+            Result result = measure(threads, elastic);
+            OSAL_LOGI("%-8u %-10s %-12.2f %-14u %-8u %-10u %u\n", threads, elastic ? "elastic" : "fixed",
+                      result.burstMs, result.idleThreads, result.stats.peakThreads, result.stats.threadsCreated,
+                      result.stats.threadsRetired);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 扇出/扇入开销测试: 比较"信号量+共享结构体"的手写方式与submit返回OSALFuture的方式
+// 用法: bench_future [线程数]
+
+#include "benchmark_common.h"
+#include "osal_semaphore.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr int kFanOut = 16;
+constexpr int kRounds = 20000;
+constexpr uint32_t kWorkIterations = 100;
+
+// 手写方式: 每个任务一个结果结构体和一个信号量
+struct ManualResult {
+    int input;
+    int output;
+    OSALSemaphore done;
+};
+
+void manualTask(void *arg) {
+    auto *result = static_cast<ManualResult *>(arg);
+    bench::spinWork(kWorkIterations);
+    result->output = result->input * 2;
+    result->done.signal();
+}
+
+double runManual(OSALThreadPool &pool) {
+    uint64_t begin = bench::nowNs();
+    for (int round = 0; round < kRounds; ++round) {
+        ManualResult results[kFanOut];
+        for (int i = 0; i < kFanOut; ++i) {
+            results[i].input = i;
+            pool.submit(manualTask, &results[i], 0);
+        }
+        int sum = 0;
+        for (auto &result : results) {
+            result.done.wait();
+            sum += result.output;
+        }
+        (void)sum;
+    }
+    return kRounds * kFanOut * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+double runFuture(OSALThreadPool &pool) {
+    uint64_t begin = bench::nowNs();
+    for (int round = 0; round < kRounds; ++round) {
+        OSALFuture<int> results[kFanOut];
+        for (int i = 0; i < kFanOut; ++i) {
+            results[i] = pool.submit(
+                [](int input) {
+                    bench::spinWork(kWorkIterations);
+                    return input * 2;
+                },
+                i);
+        }
+        int sum = 0;
+        for (auto &result : results) {
+            sum += result.get();
+        }
+        (void)sum;
+    }
+    return kRounds * kFanOut * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSAL_LOGI("%-8s %-22s %s\n", "threads", "semaphore(task/s)", "future(task/s)");
+    for (uint32_t threads : bench::threadSweep(maxThreads)) {
+        OSALThreadPool pool;
+        pool.start(threads, 0, 0);
+        double manual = runManual(pool);
+        double future = runFuture(pool);
+        pool.stop();
+        OSAL_LOGI("%-8u %-22.0f %.0f\n", threads, manual, future);
+    }
+    return 0;
+}
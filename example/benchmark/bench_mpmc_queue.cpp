@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 多生产者多消费者队列测试: 比较互斥锁加条件变量的OSALMessageQueue与按槽位序号同步的无锁队列OSALMpmcQueue
+// 生产者数和消费者数分别取1, 2, 4 ... 直到最大线程数, 输出每秒收发的消息数
+// 用法: bench_mpmc_queue [最大线程数]
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_mpmc_queue.h"
+#include "osal_queue.h"
+#include "osal_thread.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr uint64_t kMessages = 1000000;
+constexpr uint64_t kStop = UINT64_MAX;  // 每个消费者收到一条后退出
+constexpr size_t kCapacity = 1024;
+
+template <typename Queue>
+double measure(Queue &queue, uint32_t producers, uint32_t consumers) {
+    std::vector<OSALThread> producerThreads(producers);
+    std::vector<OSALThread> consumerThreads(consumers);
+    uint64_t perProducer = kMessages / producers;
+    uint64_t begin = bench::nowNs();
+    for (auto &thread : consumerThreads) {
+        thread.start("Consumer", [&queue](void *) {
+            while (queue.receive() != kStop) {
+            }
+        }, nullptr);
+    }
+    for (auto &thread : producerThreads) {
+        thread.start("Producer", [&queue, perProducer](void *) {
+            for (uint64_t i = 0; i < perProducer; ++i) {
+                queue.send(i);
+            }
+        }, nullptr);
+    }
+    for (auto &thread : producerThreads) {
+        thread.join();
+    }
+    for (uint32_t i = 0; i < consumers; ++i) {
+        queue.send(kStop);
+    }
+    for (auto &thread : consumerThreads) {
+        thread.join();
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    return perProducer * producers * 1e9 / elapsed;
+}
+
+OSALMpmcQueue<uint64_t, kCapacity> mpmcQueue;
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSALMessageQueue<uint64_t> queue(kCapacity);
+    OSAL_LOGI("%llu messages per run\n", (unsigned long long)kMessages);
+    OSAL_LOGI("%-10s %-10s %-20s %s\n", "producers", "consumers", "mutex(msg/s)", "mpmc(msg/s)");
+    for (uint32_t producers : bench::threadSweep(maxThreads)) {
+        for (uint32_t consumers : bench::threadSweep(maxThreads)) {
+            double locked = measure(queue, producers, consumers);
+            double lockFree = measure(mpmcQueue, producers, consumers);
+            OSAL_LOGI("%-10u %-10u %-20.0f %.0f\n", producers, consumers, locked, lockFree);
+        }
+    }
+    return 0;
+}
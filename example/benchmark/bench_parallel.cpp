@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 数据并行算法测试: 比较串行循环、手工分块(submit+计数信号量)与parallelFor/parallelReduce/parallelTransform
+// 负载分为均匀和倾斜(越靠后的元素越重)两种, 后者体现自适应分块的负载均衡效果
+// 用法: bench_parallel [最大线程数]
+
+#include <atomic>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_parallel.h"
+#include "osal_semaphore.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr int kElements = 100000;
+constexpr int kRepeats = 5;
+
+inline uint32_t cost(int i, bool skewed) { return skewed ? 1 + static_cast<uint32_t>(i) / 500 : 100; }
+
+inline uint64_t element(int i, bool skewed) {
+    bench::spinWork(cost(i, skewed));
+    return static_cast<uint64_t>(i);
+}
+
+double serialSum(bool skewed) {
+    uint64_t begin = bench::nowNs();
+    for (int r = 0; r < kRepeats; ++r) {
+        uint64_t sum = 0;
+        for (int i = 0; i < kElements; ++i) {
+            sum += element(i, skewed);
+        }
+        (void)sum;
+    }
+    return static_cast<double>(bench::nowNs() - begin) / 1e6 / kRepeats;
+}
+
+// 现有写法: 按线程数均分为固定块, 每块一个任务, 用计数信号量等待全部完成
+struct ManualChunk {
+    int begin;
+    int end;
+    bool skewed;
+    std::atomic<uint64_t> *sum;
+    std::atomic<int> *remaining;
+    OSALSemaphore *done;
+};
+
+void manualTask(void *arg) {
+    auto *chunk = static_cast<ManualChunk *>(arg);
+    uint64_t local = 0;
+    for (int i = chunk->begin; i < chunk->end; ++i) {
+        local += element(i, chunk->skewed);
+    }
+    chunk->sum->fetch_add(local);
+    if (chunk->remaining->fetch_sub(1) == 1) {
+        chunk->done->signal();
+    }
+}
+
+double manualSum(OSALThreadPool &pool, uint32_t threads, bool skewed) {
+    uint64_t begin = bench::nowNs();
+    for (int r = 0; r < kRepeats; ++r) {
+        std::atomic<uint64_t> sum{0};
+        std::atomic<int> remaining{static_cast<int>(threads)};
+        OSALSemaphore done;
+        std::vector<ManualChunk> chunks(threads);
+        int size = (kElements + static_cast<int>(threads) - 1) / static_cast<int>(threads);
+        for (uint32_t t = 0; t < threads; ++t) {
+            int chunkBegin = static_cast<int>(t) * size;
+            chunks[t] = ManualChunk{chunkBegin, std::min(kElements, chunkBegin + size), skewed, &sum, &remaining, &done};
+            pool.submit(manualTask, &chunks[t], 0);
+        }
+        done.wait();
+    }
+    return static_cast<double>(bench::nowNs() - begin) / 1e6 / kRepeats;
+}
+
+double parallelSum(OSALThreadPool &pool, bool skewed) {
+    uint64_t begin = bench::nowNs();
+    for (int r = 0; r < kRepeats; ++r) {
+        uint64_t sum = parallelReduce(
+            pool, 0, kElements, 0, uint64_t{0}, [skewed](int i) { return element(i, skewed); },
+            [](uint64_t a, uint64_t b) { return a + b; });
+        (void)sum;
+    }
+    return static_cast<double>(bench::nowNs() - begin) / 1e6 / kRepeats;
+}
+
+double parallelForLoop(OSALThreadPool &pool, bool skewed) {
+    std::vector<uint64_t> out(kElements);
+    uint64_t begin = bench::nowNs();
+    for (int r = 0; r < kRepeats; ++r) {
+        parallelFor(pool, 0, kElements, 0, [&out, skewed](int i) { out[i] = element(i, skewed); });
+    }
+    return static_cast<double>(bench::nowNs() - begin) / 1e6 / kRepeats;
+}
+
+double parallelTransformLoop(OSALThreadPool &pool, bool skewed) {
+    std::vector<int> in(kElements);
+    for (int i = 0; i < kElements; ++i) {
+        in[i] = i;
+    }
+    std::vector<uint64_t> out(kElements);
+    uint64_t begin = bench::nowNs();
+    for (int r = 0; r < kRepeats; ++r) {
+        parallelTransform(pool, in.begin(), in.end(), out.begin(), 0, [skewed](int i) { return element(i, skewed); });
+    }
+    return static_cast<double>(bench::nowNs() - begin) / 1e6 / kRepeats;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    for (bool skewed : {false, true}) {
+        OSAL_LOGI("%s load, serial: %.2f ms\n", skewed ? "skewed" : "uniform", serialSum(skewed));
+        OSAL_LOGI("%-8s %-16s %-16s %-16s %s\n", "threads", "manual(ms)", "reduce(ms)", "for(ms)", "transform(ms)");
+        for (uint32_t threads : bench::threadSweep(maxThreads)) {
+            OSALThreadPool pool;
+            pool.start(threads, 0, 0);
+            double manual = manualSum(pool, threads, skewed);
+            double reduce = parallelSum(pool, skewed);
+            double forLoop = parallelForLoop(pool, skewed);
+            double transform = parallelTransformLoop(pool, skewed);
+            pool.stop();
+            OSAL_LOGI("%-8u %-16.2f %-16.2f %-16.2f %.2f\n", threads, manual, reduce, forLoop, transform);
+        }
+    }
+    return 0;
+}
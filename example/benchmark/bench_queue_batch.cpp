@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 批量收发测试: 生产者按突发批次发送, 比较逐条send/tryReceive与sendBatch/receiveBatchFor
+// 输出每秒收发的消息数与整个过程中的上下文切换次数
+// 用法: bench_queue_batch
+
+#include <sys/resource.h>
+
+#include <cstdint>
+
+#include "benchmark_common.h"
+#include "osal_queue.h"
+#include "osal_thread.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr uint64_t kMessages = 2000000;
+constexpr size_t kBurst = 64;
+constexpr uint32_t kCapacity = 1024;
+
+struct Result {
+    double messagesPerSecond;
+    long contextSwitches;
+};
+
+long contextSwitches() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_nvcsw + usage.ru_nivcsw;
+}
+
+template <typename Produce, typename Consume>
+Result measure(Produce produce, Consume consume) {
+    OSALThread producer;
+    long switches = contextSwitches();
+    uint64_t begin = bench::nowNs();
+    producer.start("Producer", [&produce](void *) {
+        uint64_t burst[kBurst];
+        for (uint64_t sent = 0; sent < kMessages; sent += kBurst) {
+            for (size_t i = 0; i < kBurst; ++i) {
+                burst[i] = sent + i;
+            }
+            produce(burst);
+        }
+    }, nullptr);
+    uint64_t received = 0;
+    while (received < kMessages) {
+        received += consume();
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    producer.join();
+    return {kMessages * 1e9 / elapsed, contextSwitches() - switches};
+}
+
+Result measureSingle() {
+    OSALMessageQueue<uint64_t> queue(kCapacity);
+    return measure(
+        [&queue](uint64_t (&burst)[kBurst]) {
+            for (uint64_t message : burst) {
+                queue.send(message);
+            }
+        },
+        [&queue]() -> uint64_t {
+            uint64_t message = 0;
+            if (!queue.receiveFor(message, 100)) return 0;
+            uint64_t count = 1;
+            while (count < kBurst && queue.tryReceive(message)) {
+                ++count;
+            }
+            return count;
+        });
+}
+
+Result measureBatch() {
+    OSALMessageQueue<uint64_t> queue(kCapacity);
+    uint64_t out[kBurst] = {};
+    return measure([&queue](uint64_t (&burst)[kBurst]) { queue.sendBatch(burst); },
+                   [&queue, &out]() -> uint64_t { return queue.receiveBatchFor(out, kBurst, 100); });
+}
+
+}  // namespace
+
+int main() {
+    OSAL_LOGI("%llu messages in bursts of %zu\n", (unsigned long long)kMessages, kBurst);
+    OSAL_LOGI("%-10s %-16s %s\n", "api", "msg/s", "context switches");
+    Result single = measureSingle();
+    OSAL_LOGI("%-10s %-16.0f %ld\n", "single", single.messagesPerSecond, single.contextSwitches);
+    Result batch = measureBatch();
+    OSAL_LOGI("%-10s %-16.0f %ld\n", "batch", batch.messagesPerSecond, batch.contextSwitches);
+    return 0;
+}
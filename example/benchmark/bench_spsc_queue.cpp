@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 单生产者单消费者队列测试: 比较互斥锁加条件变量的OSALMessageQueue与无锁环形队列OSALSpscQueue
+// 吞吐量: 一个线程连续发送, 另一个线程连续接收; 延迟: 两个队列来回传递一条消息(乒乓), 输出平均往返耗时
+// 用法: bench_spsc_queue
+
+#include <cstdint>
+
+#include "benchmark_common.h"
+#include "osal_queue.h"
+#include "osal_spsc_queue.h"
+#include "osal_thread.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr uint64_t kMessages = 2000000;
+constexpr uint32_t kRounds = 20000;
+constexpr size_t kCapacity = 1024;
+
+// 返回每秒收发的消息数
+template <typename Queue>
+double measureThroughput(Queue &queue) {
+    OSALThread producer;
+    uint64_t begin = bench::nowNs();
+    producer.start("Producer", [&queue](void *) {
+        for (uint64_t i = 0; i < kMessages; ++i) {
+            queue.send(i);
+        }
+    }, nullptr);
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < kMessages; ++i) {
+        checksum += queue.receive();
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    producer.join();
+    if (checksum != kMessages * (kMessages - 1) / 2) {
+        OSAL_LOGE("checksum mismatch\n");
+    }
+    return kMessages * 1e9 / elapsed;
+}
+
+// 返回平均往返耗时(ns)
+template <typename Queue>
+double measureLatency(Queue &ping, Queue &pong) {
+    OSALThread responder;
+    responder.start("Responder", [&ping, &pong](void *) {
+        for (uint32_t i = 0; i < kRounds; ++i) {
+            pong.send(ping.receive());
+        }
+    }, nullptr);
+    uint64_t begin = bench::nowNs();
+    for (uint32_t i = 0; i < kRounds; ++i) {
+        ping.send(i);
+        pong.receive();
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    responder.join();
+    return static_cast<double>(elapsed) / kRounds;
+}
+
+OSALSpscQueue<uint64_t, kCapacity> spscQueue;
+OSALSpscQueue<uint64_t, kCapacity> spscPing;
+OSALSpscQueue<uint64_t, kCapacity> spscPong;
+
+}  // namespace
+
+int main() {
+    OSALMessageQueue<uint64_t> queue(kCapacity);
+    OSALMessageQueue<uint64_t> ping(kCapacity);
+    OSALMessageQueue<uint64_t> pong(kCapacity);
+    OSAL_LOGI("%llu messages, %u ping-pong rounds\n", (unsigned long long)kMessages, kRounds);
+    OSAL_LOGI("%-20s %-16s %s\n", "queue", "msg/s", "round-trip(ns)");
+    OSAL_LOGI("%-20s %-16.0f %.1f\n", "OSALMessageQueue", measureThroughput(queue), measureLatency(ping, pong));
+    OSAL_LOGI("%-20s %-16.0f %.1f\n", "OSALSpscQueue", measureThroughput(spscQueue),
+              measureLatency(spscPing, spscPong));
+    return 0;
+}
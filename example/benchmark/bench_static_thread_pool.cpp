@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 静态线程池测试: 比较OSALThreadPool与对象内预分配槽位和线程栈的OSALStaticThreadPool
+// 分别统计启动时与提交执行任务时的堆分配次数, 以及任务吞吐量
+// 用法: bench_static_thread_pool
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "benchmark_common.h"
+#include "osal_semaphore.h"
+#include "osal_static_thread_pool.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+std::atomic<uint64_t> allocationCount{0};
+
+}  // namespace
+
+// 统计全进程的堆分配次数
+void *operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+constexpr uint32_t kWorkers = 4;
+constexpr size_t kQueueDepth = 1024;
+constexpr int kTasks = 200000;
+constexpr int kRounds = 3;
+
+struct Context {
+    std::atomic<int> remaining;
+    OSALSemaphore done;
+};
+
+inline void finish(Context *ctx) {
+    if (ctx->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        ctx->done.signal();
+    }
+}
+
+struct Result {
+    double allocationsPerTask;
+    double tasksPerSecond;
+};
+
+template <typename Pool>
+Result measure(Pool &pool) {
+    Context ctx{{kTasks}, {}};
+    uint64_t allocations = allocationCount.load();
+    uint64_t begin = bench::nowNs();
+    for (int i = 0; i < kTasks; ++i) {
+        pool.post([&ctx]() { finish(&ctx); });
+    }
+    ctx.done.wait();
+    uint64_t elapsed = bench::nowNs() - begin;
+    return {static_cast<double>(allocationCount.load() - allocations) / kTasks, kTasks * 1e9 / elapsed};
+}
+
+StaticThreadPool<kWorkers, kQueueDepth> staticPool;
+
+}  // namespace
+
+int main() {
+    uint64_t allocations = allocationCount.load();
+    OSALThreadPool pool;
+    pool.start(kWorkers, 0, 0);
+    uint64_t poolStartAllocations = allocationCount.load() - allocations;
+
+    allocations = allocationCount.load();
+    staticPool.start();
+    uint64_t staticStartAllocations = allocationCount.load() - allocations;
+
+    OSAL_LOGI("%u workers, queue depth %zu, %d tasks per round\n", kWorkers, kQueueDepth, kTasks);
+    OSAL_LOGI("%-8s %-12s %-14s %-16s %s\n", "round", "pool", "alloc(start)", "alloc/task", "task/s");
+    for (int round = 0; round < kRounds; ++round) {
+        Result dynamic = measure(pool);
+        Result fixed = measure(staticPool);
+        OSAL_LOGI("%-8d %-12s %-14llu %-16.3f %.0f\n", round, "dynamic", (unsigned long long)poolStartAllocations,
+                  dynamic.allocationsPerTask, dynamic.tasksPerSecond);
+        OSAL_LOGI("%-8d %-12s %-14llu %-16.3f %.0f\n", round, "static", (unsigned long long)staticStartAllocations,
+                  fixed.allocationsPerTask, fixed.tasksPerSecond);
+    }
+    pool.stop();
+    staticPool.stop();
+    return 0;
+}
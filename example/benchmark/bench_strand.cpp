@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// 串行执行器测试: N个组件各收到M条消息, 每个组件的回调必须串行执行
+// 比较直接提交到线程池并在回调中加组件的OSALMutex与每个组件一个OSALStrand
+// 用法: bench_strand [最大线程数]
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_mutex.h"
+#include "osal_strand.h"
+#include "osal_system.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr size_t kActors = 1000;
+constexpr size_t kMessages = 100;
+constexpr uint32_t kWork = 200;
+
+struct MutexActor {
+    OSALMutex mutex;
+    uint64_t state = 0;
+};
+
+struct StrandActor {
+    explicit StrandActor(OSALThreadPool &pool) : strand(pool) {}
+
+    OSALStrand strand;
+    uint64_t state = 0;
+};
+
+void waitFor(std::atomic<size_t> &done, size_t total) {
+    while (done < total) {
+        OSALSystem::getInstance().yield();
+    }
+}
+
+// 返回处理全部消息的耗时(ms)
+double measureMutex(uint32_t threads) {
+    OSALThreadPool pool;
+    pool.start(threads, 0, 0);
+    std::vector<std::unique_ptr<MutexActor>> actors;
+    for (size_t i = 0; i < kActors; ++i) {
+        actors.push_back(std::make_unique<MutexActor>());
+    }
+    std::atomic<size_t> done{0};
+    uint64_t begin = bench::nowNs();
+    for (size_t m = 0; m < kMessages; ++m) {
+        for (auto &actor : actors) {
+            MutexActor *self = actor.get();
+            pool.post([self, &done]() {
+                self->mutex.lock();
+                bench::spinWork(kWork);
+                ++self->state;
+                self->mutex.unlock();
+                ++done;
+            });
+        }
+    }
+    waitFor(done, kActors * kMessages);
+    uint64_t elapsed = bench::nowNs() - begin;
+    pool.stop();
+    return elapsed / 1e6;
+}
+
+double measureStrand(uint32_t threads) {
+    OSALThreadPool pool;
+    pool.start(threads, 0, 0);
+    std::vector<std::unique_ptr<StrandActor>> actors;
+    for (size_t i = 0; i < kActors; ++i) {
+        actors.push_back(std::make_unique<StrandActor>(pool));
+    }
+    std::atomic<size_t> done{0};
+    uint64_t begin = bench::nowNs();
+    for (size_t m = 0; m < kMessages; ++m) {
+        for (auto &actor : actors) {
+            StrandActor *self = actor.get();
+            self->strand.post([self, &done]() {
+                bench::spinWork(kWork);
+                ++self->state;
+                ++done;
+            });
+        }
+    }
+    waitFor(done, kActors * kMessages);
+    uint64_t elapsed = bench::nowNs() - begin;
+    pool.stop();
+    return elapsed / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSAL_LOGI("%zu actors x %zu messages\n", kActors, kMessages);
+    OSAL_LOGI("%-8s %-16s %s\n", "threads", "mutex(ms)", "strand(ms)");
+    for (uint32_t threads : bench::threadSweep(maxThreads)) {
+        double mutex = measureMutex(threads);
+        double strand = measureStrand(threads);
+        OSAL_LOGI("%-8u %-16.2f %.2f\n", threads, mutex, strand);
+    }
+    return 0;
+}
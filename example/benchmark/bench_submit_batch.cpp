@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 批量提交测试: 一次扇出大量小任务, 比较逐个submit()与submitBatch()的吞吐量
+// 用法: bench_submit_batch [最大线程数]
+
+#include <atomic>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_semaphore.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr int kBatchSize = 10000;
+constexpr int kRounds = 20;
+constexpr uint32_t kWorkIterations = 50;
+
+struct Context {
+    std::atomic<int> remaining;
+    OSALSemaphore done;
+};
+
+void leafTask(void *arg) {
+    auto *ctx = static_cast<Context *>(arg);
+    bench::spinWork(kWorkIterations);
+    if (ctx->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        ctx->done.signal();
+    }
+}
+
+double runSingle(OSALThreadPool &pool) {
+    uint64_t begin = bench::nowNs();
+    for (int round = 0; round < kRounds; ++round) {
+        Context ctx{{kBatchSize}, {}};
+        for (int i = 0; i < kBatchSize; ++i) {
+            pool.submit(leafTask, &ctx, 0);
+        }
+        ctx.done.wait();
+    }
+    return kRounds * kBatchSize * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+double runBatch(OSALThreadPool &pool) {
+    std::vector<OSALThreadPool::Task> tasks;
+    tasks.reserve(kBatchSize);
+    uint64_t begin = bench::nowNs();
+    for (int round = 0; round < kRounds; ++round) {
+        Context ctx{{kBatchSize}, {}};
+        tasks.clear();
+        for (int i = 0; i < kBatchSize; ++i) {
+            tasks.push_back(OSALThreadPool::Task{leafTask, &ctx, 0});
+        }
+        pool.submitBatch(std::span<OSALThreadPool::Task>(tasks));
+        ctx.done.wait();
+    }
+    return kRounds * kBatchSize * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+double measure(OSALThreadPool::SchedulingMode mode, uint32_t threads, bool batch) {
+    OSALThreadPool pool;
+    pool.setSchedulingMode(mode);
+    pool.start(threads, 0, 0);
+    double rate = batch ? runBatch(pool) : runSingle(pool);
+    pool.stop();
+    return rate;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSAL_LOGI("%-8s %-22s %-22s %-22s %s\n", "threads", "shared single(task/s)", "shared batch(task/s)",
+              "stealing single(task/s)", "stealing batch(task/s)");
+    for (uint32_t threads : bench::threadSweep(maxThreads)) {
+        double sharedSingle = measure(OSALThreadPool::SchedulingMode::SharedQueue, threads, false);
+        double sharedBatch = measure(OSALThreadPool::SchedulingMode::SharedQueue, threads, true);
+        double stealingSingle = measure(OSALThreadPool::SchedulingMode::WorkStealing, threads, false);
+        double stealingBatch = measure(OSALThreadPool::SchedulingMode::WorkStealing, threads, true);
+        OSAL_LOGI("%-8u %-22.0f %-22.0f %-22.0f %.0f\n", threads, sharedSingle, sharedBatch, stealingSingle,
+                  stealingBatch);
+    }
+    return 0;
+}
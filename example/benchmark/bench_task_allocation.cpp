@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 任务提交开销测试: 比较std::function接口与可调用对象模板接口在相同捕获大小下的堆分配次数与吞吐量
+// 用法: bench_task_allocation [线程数]
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "benchmark_common.h"
+#include "osal_semaphore.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+std::atomic<uint64_t> allocationCount{0};
+
+}  // namespace
+
+// 统计全进程的堆分配次数
+void *operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+constexpr int kTasks = 200000;
+constexpr int kRounds = 3;
+
+struct Context {
+    std::atomic<int> remaining;
+    OSALSemaphore done;
+};
+
+// 捕获48字节的闭包, 超出std::function的小对象缓冲区
+struct Payload {
+    Context *ctx;
+    uint64_t values[5];
+};
+
+inline void finish(Context *ctx) {
+    if (ctx->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        ctx->done.signal();
+    }
+}
+
+struct Result {
+    double allocationsPerTask;
+    double tasksPerSecond;
+};
+
+template <typename SubmitFn>
+Result measure(SubmitFn submit) {
+    Context ctx{{kTasks}, {}};
+    uint64_t allocations = allocationCount.load();
+    uint64_t begin = bench::nowNs();
+    for (int i = 0; i < kTasks; ++i) {
+        submit(Payload{&ctx, {uint64_t(i), 1, 2, 3, 4}});
+    }
+    ctx.done.wait();
+    uint64_t elapsed = bench::nowNs() - begin;
+    return {static_cast<double>(allocationCount.load() - allocations) / kTasks, kTasks * 1e9 / elapsed};
+}
+
+Result runLegacy(OSALThreadPool &pool) {
+    return measure([&pool](Payload payload) {
+        pool.submit([payload](void *) { finish(payload.ctx); }, nullptr, 0);
+    });
+}
+
+Result runCallable(OSALThreadPool &pool) {
+    return measure([&pool](Payload payload) { pool.post([payload]() { finish(payload.ctx); }); });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t threads = bench::maxThreadsFromArgs(argc, argv);
+    OSALThreadPool pool;
+    pool.start(threads, 0, 0);
+    // 预热一轮, 使就绪队列的环形缓冲区扩容到位
+    runLegacy(pool);
+    runCallable(pool);
+
+    OSAL_LOGI("%-8s %-12s %-16s %s\n", "round", "api", "alloc/task", "task/s");
+    for (int round = 0; round < kRounds; ++round) {
+        Result legacy = runLegacy(pool);
+        Result callable = runCallable(pool);
+        OSAL_LOGI("%-8d %-12s %-16.3f %.0f\n", round, "function", legacy.allocationsPerTask, legacy.tasksPerSecond);
+        OSAL_LOGI("%-8d %-12s %-16.3f %.0f\n", round, "callable", callable.allocationsPerTask,
+                  callable.tasksPerSecond);
+    }
+    pool.stop();
+    return 0;
+}
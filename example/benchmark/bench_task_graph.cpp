@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 任务图测试: 每帧一个40个阶段的依赖图(8层, 每层5个节点, 每个节点依赖上一层的2个节点, 负载不均),
+// 比较按层提交并用信号量等待整层完成的做法与OSALTaskGraph按依赖计数直接调度后继的帧率
+// 用法: bench_task_graph [最大线程数]
+
+#include <atomic>
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_semaphore.h"
+#include "osal_task_graph.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr int kLayers = 8;
+constexpr int kWidth = 5;
+constexpr int kFrames = 2000;
+constexpr uint32_t kBaseWork = 2000;
+
+// 节点负载在1~5倍之间变化, 按层同步时每层都要等最慢的节点
+uint32_t stageWork(int layer, int index) { return kBaseWork * static_cast<uint32_t>((layer * 3 + index * 7) % 5 + 1); }
+
+struct LayerContext;
+
+struct StageArgument {
+    LayerContext *layer;
+    uint32_t work;
+};
+
+struct LayerContext {
+    std::atomic<int> remaining;
+    OSALSemaphore done;
+    StageArgument stages[kWidth];
+};
+
+void layerTask(void *arg) {
+    auto *stage = static_cast<StageArgument *>(arg);
+    bench::spinWork(stage->work);
+    if (stage->layer->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        stage->layer->done.signal();
+    }
+}
+
+double runSemaphoreChained(OSALThreadPool &pool) {
+    uint64_t begin = bench::nowNs();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        for (int layer = 0; layer < kLayers; ++layer) {
+            LayerContext ctx{{kWidth}, {}, {}};
+            for (int i = 0; i < kWidth; ++i) {
+                ctx.stages[i] = StageArgument{&ctx, stageWork(layer, i)};
+            }
+            for (int i = 0; i < kWidth; ++i) {
+                pool.submit(layerTask, &ctx.stages[i], 0);
+            }
+            ctx.done.wait();
+        }
+    }
+    return kFrames * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+double runTaskGraph(OSALThreadPool &pool) {
+    OSALTaskGraph graph;
+    OSALTaskGraph::NodeId nodes[kLayers][kWidth];
+    for (int layer = 0; layer < kLayers; ++layer) {
+        for (int i = 0; i < kWidth; ++i) {
+            uint32_t work = stageWork(layer, i);
+            nodes[layer][i] = graph.addNode([work]() { bench::spinWork(work); });
+            if (layer > 0) {
+                graph.precede(nodes[layer - 1][i], nodes[layer][i]);
+                graph.precede(nodes[layer - 1][(i + 1) % kWidth], nodes[layer][i]);
+            }
+        }
+    }
+    uint64_t begin = bench::nowNs();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        graph.run(pool);
+    }
+    return kFrames * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+double measure(uint32_t threads, bool graph) {
+    OSALThreadPool pool;
+    pool.start(threads, 0, 0);
+    double rate = graph ? runTaskGraph(pool) : runSemaphoreChained(pool);
+    pool.stop();
+    return rate;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSAL_LOGI("%-8s %-24s %s\n", "threads", "semaphore chain(frame/s)", "task graph(frame/s)");
+    for (uint32_t threads : bench::threadSweep(maxThreads)) {
+        OSAL_LOGI("%-8u %-24.0f %.0f\n", threads, measure(threads, false), measure(threads, true));
+    }
+    return 0;
+}
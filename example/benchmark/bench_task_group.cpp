@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+// 分叉-合并测试: 提交N个小任务后等待全部完成, 比较逐个等待future(调用线程休眠)与任务组(调用线程帮忙执行)
+// 用法: bench_task_group [最大线程数]
+
+#include <vector>
+
+#include "benchmark_common.h"
+#include "osal_future.h"
+#include "osal_task_group.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr size_t kTasks = 20000;
+constexpr uint32_t kWork = 500;
+constexpr int kRounds = 5;
+
+// 返回每轮的平均耗时(ms)
+double measureFutures(uint32_t threads) {
+    OSALThreadPool pool;
+    pool.start(threads, 0, 0);
+    uint64_t begin = bench::nowNs();
+    for (int round = 0; round < kRounds; ++round) {
+        std::vector<OSALFuture<void>> futures;
+        futures.reserve(kTasks);
+        for (size_t i = 0; i < kTasks; ++i) {
+            futures.push_back(pool.submit([]() { bench::spinWork(kWork); }));
+        }
+        for (auto &future : futures) {
+            future.wait();
+        }
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    pool.stop();
+    return elapsed / 1e6 / kRounds;
+}
+
+double measureGroup(uint32_t threads) {
+    OSALThreadPool pool;
+    pool.start(threads, 0, 0);
+    uint64_t begin = bench::nowNs();
+    for (int round = 0; round < kRounds; ++round) {
+        OSALTaskGroup group(pool);
+        for (size_t i = 0; i < kTasks; ++i) {
+            group.run([]() { bench::spinWork(kWork); });
+        }
+        group.wait();
+    }
+    uint64_t elapsed = bench::nowNs() - begin;
+    pool.stop();
+    return elapsed / 1e6 / kRounds;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSAL_LOGI("%zu tasks per round\n", kTasks);
+    OSAL_LOGI("%-8s %-16s %s\n", "threads", "futures(ms)", "task group(ms)");
+    for (uint32_t threads : bench::threadSweep(maxThreads)) {
+        double futures = measureFutures(threads);
+        double group = measureGroup(threads);
+        OSAL_LOGI("%-8u %-16.2f %.2f\n", threads, futures, group);
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// 线程池扩展性测试: 线程数从1递增到N, 比较共享队列与工作窃取两种调度模式的吞吐量
+// 用法: bench_thread_pool_scaling [最大线程数]
+
+#include <atomic>
+
+#include "benchmark_common.h"
+#include "osal_semaphore.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+
+constexpr int kFlatTasks = 200000;     // 外部直接提交的任务数
+constexpr int kParentTasks = 2000;     // 嵌套提交场景的父任务数
+constexpr int kChildrenPerParent = 100;  // 每个父任务派生的子任务数
+constexpr uint32_t kWorkIterations = 200;
+
+struct Context {
+    OSALThreadPool *pool;
+    std::atomic<int> remaining;
+    OSALSemaphore done;
+};
+
+void leafTask(void *arg) {
+    auto *ctx = static_cast<Context *>(arg);
+    bench::spinWork(kWorkIterations);
+    if (--ctx->remaining == 0) {
+        ctx->done.signal();
+    }
+}
+
+void parentTask(void *arg) {
+    auto *ctx = static_cast<Context *>(arg);
+    for (int i = 0; i < kChildrenPerParent; ++i) {
+        ctx->pool->submit(leafTask, ctx, 0);
+    }
+    leafTask(ctx);
+}
+
+// 返回每秒完成的任务数
+double runFlat(OSALThreadPool &pool) {
+    Context ctx{&pool, {kFlatTasks}, {}};
+    uint64_t begin = bench::nowNs();
+    for (int i = 0; i < kFlatTasks; ++i) {
+        pool.submit(leafTask, &ctx, 0);
+    }
+    ctx.done.wait();
+    return kFlatTasks * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+double runNested(OSALThreadPool &pool) {
+    const int total = kParentTasks * (kChildrenPerParent + 1);
+    Context ctx{&pool, {total}, {}};
+    uint64_t begin = bench::nowNs();
+    for (int i = 0; i < kParentTasks; ++i) {
+        pool.submit(parentTask, &ctx, 0);
+    }
+    ctx.done.wait();
+    return total * 1e9 / static_cast<double>(bench::nowNs() - begin);
+}
+
+double measure(OSALThreadPool::SchedulingMode mode, uint32_t threads, bool nested) {
+    OSALThreadPool pool;
+    pool.setSchedulingMode(mode);
+    pool.start(threads, 0, 0);
+    double rate = nested ? runNested(pool) : runFlat(pool);
+    pool.stop();
+    return rate;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    uint32_t maxThreads = bench::maxThreadsFromArgs(argc, argv);
+    OSAL_LOGI("%-8s %-22s %-22s %-22s %s\n", "threads", "shared flat(task/s)", "stealing flat(task/s)",
+              "shared nested(task/s)", "stealing nested(task/s)");
+    for (uint32_t threads : bench::threadSweep(maxThreads)) {
+        double sharedFlat = measure(OSALThreadPool::SchedulingMode::SharedQueue, threads, false);
+        double stealingFlat = measure(OSALThreadPool::SchedulingMode::WorkStealing, threads, false);
+        double sharedNested = measure(OSALThreadPool::SchedulingMode::SharedQueue, threads, true);
+        double stealingNested = measure(OSALThreadPool::SchedulingMode::WorkStealing, threads, true);
+        OSAL_LOGI("%-8u %-22.0f %-22.0f %-22.0f %.0f\n", threads, sharedFlat, stealingFlat, sharedNested,
+                  stealingNested);
+    }
+    return 0;
+}
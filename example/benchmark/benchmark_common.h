@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BENCHMARK_COMMON_H
+#define BENCHMARK_COMMON_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "osal_debug.h"
+
+namespace bench {
+
+// 单调时钟, 纳秒
+inline uint64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// 模拟少量计算的任务负载, 避免被编译器优化掉
+inline void spinWork(uint32_t iterations) {
+    static std::atomic<uint32_t> sink{0};
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        value = value * 1664525u + 1013904223u;
+    }
+    sink.fetch_add(value, std::memory_order_relaxed);
+}
+
+// 从命令行获取最大线程数, 默认取CPU核数
+inline uint32_t maxThreadsFromArgs(int argc, char **argv) {
+    if (argc > 1) {
+        return static_cast<uint32_t>(std::max(1, std::atoi(argv[1])));
+    }
+    uint32_t cores = std::thread::hardware_concurrency();
+    return cores > 0 ? cores : 1;
+}
+
+// 线程数序列: 1, 2, 4, 8 ... 直到最大线程数(包含最大线程数本身)
+inline std::vector<uint32_t> threadSweep(uint32_t maxThreads) {
+    std::vector<uint32_t> sweep;
+    for (uint32_t threads = 1; threads < maxThreads; threads *= 2) {
+        sweep.push_back(threads);
+    }
+    sweep.push_back(maxThreads);
+    return sweep;
+}
+
+}  // namespace bench
+
+#endif  // BENCHMARK_COMMON_H
@@ -29,6 +29,7 @@
 
 #define OSAL_CONFIG_THREAD_MINIMAL_STACK_SIZE 8 * 1024 * 1024  // 8MB栈
 #define OSAL_CONFIG_THREAD_DEFAULT_PRIORITY 0
+#define OSAL_CONFIG_STATIC_THREAD_POOL_STACK_SIZE (64 * 1024)  // 静态线程池工作线程栈, 不能小于PTHREAD_STACK_MIN
 
 void osal_port_debug_write(char* buf, uint32_t len);
 
@@ -32,6 +32,7 @@
 #define TestOSALThreadIsRunningEnabled 1
 #define TestOSALThreadSetAndGetPriorityEnabled 1
 #define TestOSALThreadSuspendAndResumeEnabled 1
+#define TestOSALThreadAffinityEnabled 1
 
 #define TestOSALChronoNowEnabled 1
 #define TestOSALChronoElapsedEnabled 1
@@ -66,6 +67,14 @@
 #define TestOSALMessageQueueReceiveForEnabled 1
 #define TestOSALMessageQueueSizeEnabled 1
 #define TestOSALMessageQueueClearEnabled 1
+#define TestOSALMessageQueueMoveSendEnabled 1
+#define TestOSALMessageQueueBatchEnabled 1
+#define TestOSALMessageQueueBoundedEnabled 1
+#define TestOSALMessageQueuePriorityEnabled 1
+#define TestOSALSpscQueueSendReceiveEnabled 1
+#define TestOSALSpscQueueProducerConsumerEnabled 1
+#define TestOSALMpmcQueueSendReceiveEnabled 1
+#define TestOSALMpmcQueueMultiProducerConsumerEnabled 1
 
 #define TestOSALSemaphoreInitEnabled 1
 #define TestOSALSemaphoreWaitSignalEnabled 1
@@ -83,6 +92,43 @@
 #define TestOSALThreadPoolSetMaxThreadsEnabled 1
 #define TestOSALThreadPoolSetTaskFailureCallbackEnabled 1
 #define TestOSALThreadPoolSetMinThreadsEnabled 1
+#define TestOSALThreadPoolWorkStealingEnabled 1
+#define TestOSALThreadPoolTaskPriorityEnabled 1
+#define TestOSALThreadPoolPriorityAgingEnabled 1
+#define TestOSALThreadPoolSubmitCallableEnabled 1
+#define TestOSALThreadPoolSubmitFutureEnabled 1
+#define TestOSALThreadPoolFutureThenEnabled 1
+#define TestOSALThreadPoolSubmitBatchEnabled 1
+#define TestOSALThreadPoolElasticScalingEnabled 1
+#define TestOSALThreadPoolStatsEnabled 1
+#define TestOSALThreadPoolAffinityEnabled 1
+#define TestOSALThreadPoolCancelHandleEnabled 1
+#define TestOSALThreadPoolBoundedQueueEnabled 1
+#define TestOSALThreadPoolDelayedTasksEnabled 1
+#define TestOSALThreadPoolSpinPolicyEnabled 1
+#define TestOSALThreadPoolSuspendIdleEnabled 1
+
+#define TestOSALLatchCountDownEnabled 1
+#define TestOSALParallelForEnabled 1
+#define TestOSALParallelReduceEnabled 1
+#define TestOSALParallelTransformEnabled 1
+#define TestOSALTaskGraphEnabled 1
+
+#define TestOSALCoroutineTaskEnabled 1
+#define TestOSALCoroutineScheduleEnabled 1
+#define TestOSALCoroutineSemaphoreEnabled 1
+#define TestOSALCoroutineMessageQueueEnabled 1
+#define TestOSALCoroutineSleepEnabled 1
+
+#define TestOSALStrandOrderEnabled 1
+#define TestOSALStrandMultiProducerEnabled 1
+#define TestOSALStrandDispatchEnabled 1
+
+#define TestOSALTaskGroupRunAndWaitEnabled 1
+#define TestOSALTaskGroupNestedWaitEnabled 1
+
+#define TestOSALStaticThreadPoolOrderEnabled 1
+#define TestOSALStaticThreadPoolBoundedEnabled 1
 
 #define TestOSALTimerRepeatEnabled 1
 #define TestOSALTimerStartEnabled 1
@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_COROUTINE_H__
+#define __OSAL_COROUTINE_H__
+
+#ifndef OSAL_CONFIG_COROUTINE
+#if defined(__cpp_impl_coroutine)
+#define OSAL_CONFIG_COROUTINE 1  // C++20协程支持, 编译器不支持协程时为0
+#else
+#define OSAL_CONFIG_COROUTINE 0
+#endif
+#endif
+
+#if OSAL_CONFIG_COROUTINE
+
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "interface_thread_pool.h"
+#include "osal_condition_variable.h"
+#include "osal_future.h"
+#include "osal_lockguard.h"
+#include "osal_mutex.h"
+#include "osal_queue.h"
+
+namespace osal {
+
+template <typename T>
+class OSALTask;
+
+namespace detail {
+
+// 协程任务的promise公共部分: 创建后挂起, 被co_await时才开始执行; 结束时直接切换回等待者(对称转移), 不增加栈深度
+struct OSALTaskPromiseBase {
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+            std::coroutine_handle<> continuation = handle.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    // 库内不使用异常
+    void unhandled_exception() { std::abort(); }
+
+    std::coroutine_handle<> continuation;
+};
+
+template <typename T>
+struct OSALTaskPromise : OSALTaskPromiseBase {
+    OSALTask<T> get_return_object();
+
+    template <typename U>
+    void return_value(U &&value) {
+        result.emplace(std::forward<U>(value));
+    }
+
+    T takeResult() { return std::move(*result); }
+
+    std::optional<T> result;
+};
+
+template <>
+struct OSALTaskPromise<void> : OSALTaskPromiseBase {
+    OSALTask<void> get_return_object();
+
+    void return_void() {}
+
+    void takeResult() {}
+};
+
+}  // namespace detail
+
+// 惰性启动的协程任务: 协程函数返回OSALTask<T>, 在另一个协程中co_await得到结果,
+// 或通过spawn()/syncWait()从普通函数启动; 只能移动, 只能被co_await一次
+template <typename T = void>
+class [[nodiscard]] OSALTask {
+public:
+    using promise_type = detail::OSALTaskPromise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    OSALTask() = default;
+
+    explicit OSALTask(Handle handle) : handle_(handle) {}
+
+    OSALTask(OSALTask &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    OSALTask &operator=(OSALTask &&other) noexcept {
+        if (this != &other) {
+            reset();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    OSALTask(const OSALTask &) = delete;
+
+    OSALTask &operator=(const OSALTask &) = delete;
+
+    ~OSALTask() { reset(); }
+
+    [[nodiscard]] bool valid() const { return static_cast<bool>(handle_); }
+
+    [[nodiscard]] bool isDone() const { return handle_ && handle_.done(); }
+
+    auto operator co_await() noexcept {
+        struct Awaiter {
+            Handle handle;
+
+            bool await_ready() noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume() { return handle.promise().takeResult(); }
+        };
+        return Awaiter{handle_};
+    }
+
+private:
+    void reset() {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+    Handle handle_;
+};
+
+template <typename T = void>
+using Task = OSALTask<T>;
+
+namespace detail {
+
+template <typename T>
+OSALTask<T> OSALTaskPromise<T>::get_return_object() {
+    return OSALTask<T>(std::coroutine_handle<OSALTaskPromise<T>>::from_promise(*this));
+}
+
+inline OSALTask<void> OSALTaskPromise<void>::get_return_object() {
+    return OSALTask<void>(std::coroutine_handle<OSALTaskPromise<void>>::from_promise(*this));
+}
+
+// 立即开始、结束后自行销毁的协程, 用于从普通函数启动OSALTask
+struct OSALDetachedTask {
+    struct promise_type {
+        OSALDetachedTask get_return_object() noexcept { return {}; }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() { std::abort(); }
+    };
+};
+
+template <typename T>
+OSALDetachedTask runDetached(OSALTask<T> task, OSALPromise<T> promise) {
+    if constexpr (std::is_void_v<T>) {
+        co_await std::move(task);
+        promise.setValue();
+    } else {
+        promise.setValue(co_await std::move(task));
+    }
+}
+
+template <typename Pool, typename T>
+OSALDetachedTask runDetachedOn(Pool &pool, int priority, OSALTask<T> task, OSALPromise<T> promise) {
+    co_await pool.schedule(priority);
+    if constexpr (std::is_void_v<T>) {
+        co_await std::move(task);
+        promise.setValue();
+    } else {
+        promise.setValue(co_await std::move(task));
+    }
+}
+
+// 挂起的协程在等待队列中的节点, 存放在协程帧内, 入队不分配内存
+struct OSALAwaitNode {
+    std::coroutine_handle<> handle;
+    OSALAwaitNode *next = nullptr;
+};
+
+// 先进先出的侵入式等待队列, 由所属对象的锁保护
+class OSALAwaitList {
+public:
+    void push(OSALAwaitNode *node) {
+        node->next = nullptr;
+        if (tail_ != nullptr) {
+            tail_->next = node;
+        } else {
+            head_ = node;
+        }
+        tail_ = node;
+    }
+
+    OSALAwaitNode *pop() {
+        OSALAwaitNode *node = head_;
+        if (node != nullptr) {
+            head_ = node->next;
+            if (head_ == nullptr) tail_ = nullptr;
+        }
+        return node;
+    }
+
+    [[nodiscard]] bool empty() const { return head_ == nullptr; }
+
+private:
+    OSALAwaitNode *head_ = nullptr;
+    OSALAwaitNode *tail_ = nullptr;
+};
+
+}  // namespace detail
+
+// 在当前线程开始执行task, 直到它第一次挂起; 结果通过返回的future获得
+template <typename T>
+OSALFuture<T> spawn(OSALTask<T> task) {
+    OSALPromise<T> promise;
+    OSALFuture<T> future = promise.getFuture();
+    detail::runDetached(std::move(task), std::move(promise));
+    return future;
+}
+
+// 在线程池的工作线程上开始执行task
+template <typename Pool, typename T>
+OSALFuture<T> spawn(Pool &pool, OSALTask<T> task, int priority = 0) {
+    OSALPromise<T> promise;
+    OSALFuture<T> future = promise.getFuture();
+    detail::runDetachedOn(pool, priority, std::move(task), std::move(promise));
+    return future;
+}
+
+// 在当前线程开始执行task并阻塞等待结果, 不能在协程或线程池任务中调用
+template <typename T>
+T syncWait(OSALTask<T> task) {
+    return spawn(std::move(task)).get();
+}
+
+// co_await pool.schedule(): 把当前协程作为任务提交到线程池, 在工作线程上恢复执行
+// 队列已满被拒绝时不挂起, 在当前线程继续执行; CallerRuns策略下在提交线程中恢复
+// 线程池不能使用DropOldest策略, 被丢弃的恢复任务会使协程永远不再恢复, 协程帧随之泄漏
+template <typename Pool>
+class OSALScheduleAwaiter {
+public:
+    OSALScheduleAwaiter(Pool &pool, int priority) : pool_(pool), priority_(priority) {}
+
+    bool await_ready() noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        ThreadPoolSubmitStatus status = pool_.post([handle]() { handle.resume(); }, priority_);
+        return status != ThreadPoolSubmitStatus::Rejected && status != ThreadPoolSubmitStatus::Timeout;
+    }
+
+    void await_resume() noexcept {}
+
+private:
+    Pool &pool_;
+    int priority_;
+};
+
+// co_await pool.sleepFor(delay): 挂起当前协程, delay(ms)后由线程池的延时任务队列在工作线程上恢复, 不占用线程
+// 与schedule()相同, 线程池不能使用DropOldest策略, 到期后被丢弃的恢复任务会使协程帧泄漏
+template <typename Pool>
+class OSALSleepAwaiter {
+public:
+    OSALSleepAwaiter(Pool &pool, uint32_t delay, int priority) : pool_(pool), delay_(delay), priority_(priority) {}
+
+    bool await_ready() noexcept { return delay_ == 0; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        pool_.submitAfter(delay_, [handle]() { handle.resume(); }, priority_);
+    }
+
+    void await_resume() noexcept {}
+
+private:
+    Pool &pool_;
+    uint32_t delay_;
+    int priority_;
+};
+
+// 协程信号量: co_await acquire()在没有计数时挂起协程而不是阻塞线程, release()直接恢复等待最久的协程;
+// 协程在调用release()的线程上恢复, 需要回到线程池时在之后co_await pool.schedule()
+class OSALAsyncSemaphore {
+public:
+    explicit OSALAsyncSemaphore(uint32_t initialCount = 0) : count_(initialCount) {}
+
+    OSALAsyncSemaphore(const OSALAsyncSemaphore &) = delete;
+
+    OSALAsyncSemaphore &operator=(const OSALAsyncSemaphore &) = delete;
+
+    auto acquire() {
+        struct Awaiter {
+            OSALAsyncSemaphore &semaphore;
+            detail::OSALAwaitNode node;
+
+            bool await_ready() { return semaphore.tryAcquire(); }
+
+            bool await_suspend(std::coroutine_handle<> handle) {
+                OSALLockGuard lockGuard(semaphore.mutex_);
+                if (semaphore.count_ > 0) {
+                    --semaphore.count_;
+                    return false;
+                }
+                node.handle = handle;
+                semaphore.waiters_.push(&node);
+                return true;
+            }
+
+            void await_resume() noexcept {}
+        };
+        return Awaiter{*this, {}};
+    }
+
+    bool tryAcquire() {
+        OSALLockGuard lockGuard(mutex_);
+        if (count_ == 0) return false;
+        --count_;
+        return true;
+    }
+
+    // 有协程在等待时把计数直接交给它并恢复执行, 否则计数加一
+    void release() {
+        detail::OSALAwaitNode *waiter;
+        {
+            OSALLockGuard lockGuard(mutex_);
+            waiter = waiters_.pop();
+            if (waiter == nullptr) {
+                ++count_;
+                return;
+            }
+        }
+        waiter->handle.resume();
+    }
+
+    [[nodiscard]] uint32_t getValue() const {
+        OSALLockGuard lockGuard(mutex_);
+        return count_;
+    }
+
+private:
+    mutable OSALMutex mutex_;
+    uint32_t count_;
+    detail::OSALAwaitList waiters_;
+};
+
+// 协程消息队列: 包装OSALMessageQueue, co_await receive()在队列为空时挂起协程,
+// send()把消息直接交给等待最久的协程并恢复它, 没有等待的协程且队列已满时阻塞调用线程, 直到协程取走消息;
+// 协程在调用send()的线程上恢复; 消息必须经由本对象发送才能唤醒等待的协程
+template <typename T>
+class OSALAsyncMessageQueue {
+public:
+    explicit OSALAsyncMessageQueue(uint32_t queue_size = 16) : queue_(queue_size) {}
+
+    OSALAsyncMessageQueue(const OSALAsyncMessageQueue &) = delete;
+
+    OSALAsyncMessageQueue &operator=(const OSALAsyncMessageQueue &) = delete;
+
+    void send(const T &message) { deliver(message); }
+
+    void send(T &&message) { deliver(std::move(message)); }
+
+    auto receive() {
+        struct Awaiter : Receiver {
+            OSALAsyncMessageQueue &owner;
+
+            explicit Awaiter(OSALAsyncMessageQueue &queue) : owner(queue) {}
+
+            // 消息直接取到Receiver::message中, T不需要默认构造
+            bool await_ready() {
+                OSALLockGuard lockGuard(owner.mutex_);
+                this->message = owner.takeLocked();
+                return this->message.has_value();
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle) {
+                OSALLockGuard lockGuard(owner.mutex_);
+                this->message = owner.takeLocked();
+                if (this->message.has_value()) {
+                    return false;
+                }
+                this->handle = handle;
+                owner.receivers_.push(this);
+                owner.notFull_.notifyOne();  // 等待空位的发送线程可以把消息直接交给本协程
+                return true;
+            }
+
+            T await_resume() { return std::move(*this->message); }
+        };
+        return Awaiter(*this);
+    }
+
+    bool tryReceive(T &message) {
+        OSALLockGuard lockGuard(mutex_);
+        std::optional<T> taken = takeLocked();
+        if (!taken) {
+            return false;
+        }
+        message = std::move(*taken);
+        return true;
+    }
+
+    [[nodiscard]] size_t size() const { return queue_.size(); }
+
+private:
+    struct Receiver : detail::OSALAwaitNode {
+        std::optional<T> message;
+    };
+
+    // 调用方持有mutex_; 取走消息后唤醒一个因队列已满而等待的发送线程
+    std::optional<T> takeLocked() {
+        std::optional<T> message = queue_.tryTake();
+        if (message) {
+            notFull_.notifyOne();
+        }
+        return message;
+    }
+
+    // 没有等待的协程且队列已满时在notFull_上等待, 等待期间释放mutex_, 协程仍可取走消息; trySend失败时消息保持不变
+    template <typename U>
+    void deliver(U &&message) {
+        Receiver *receiver;
+        {
+            OSALLockGuard lockGuard(mutex_);
+            while ((receiver = static_cast<Receiver *>(receivers_.pop())) == nullptr) {
+                if (queue_.trySend(std::forward<U>(message))) return;
+                notFull_.wait(mutex_);
+            }
+            receiver->message.emplace(std::forward<U>(message));
+        }
+        receiver->handle.resume();
+    }
+
+    OSALMutex mutex_;
+    OSALConditionVariable notFull_;  // 队列已满时发送线程在此等待, 取走消息或协程开始等待时唤醒一个
+    OSALMessageQueue<T> queue_;
+    detail::OSALAwaitList receivers_;
+};
+
+}  // namespace osal
+
+#endif  // OSAL_CONFIG_COROUTINE
+
+#endif  // __OSAL_COROUTINE_H__
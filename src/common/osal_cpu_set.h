@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_CPU_SET_H__
+#define __OSAL_CPU_SET_H__
+
+#include <bit>
+#include <cstdint>
+
+namespace osal {
+
+// CPU集合用位掩码表示, 第i位对应第i个CPU, 0表示不限制
+using OSALCpuSet = uint64_t;
+
+inline constexpr OSALCpuSet cpuSetOf(uint32_t cpu) { return cpu < 64 ? OSALCpuSet{1} << cpu : 0; }
+
+inline constexpr uint32_t cpuSetCount(OSALCpuSet set) { return static_cast<uint32_t>(std::popcount(set)); }
+
+// 返回集合中第n个CPU的编号(按编号从小到大, n超出个数时循环), 空集合返回0
+inline constexpr uint32_t cpuSetNth(OSALCpuSet set, uint32_t n) {
+    uint32_t count = cpuSetCount(set);
+    if (count == 0) return 0;
+    for (n %= count; n > 0; --n) {
+        set &= set - 1;
+    }
+    return static_cast<uint32_t>(std::countr_zero(set));
+}
+
+}  // namespace osal
+
+#endif  // __OSAL_CPU_SET_H__
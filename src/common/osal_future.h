@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_FUTURE_H__
+#define __OSAL_FUTURE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "osal.h"
+#include "osal_debug.h"
+#include "osal_semaphore.h"
+#include "osal_spin_lock.h"
+#include "osal_task_function.h"
+
+#ifndef OSAL_CONFIG_FUTURE_POOL_SIZE
+#define OSAL_CONFIG_FUTURE_POOL_SIZE 32  // 每种结果类型缓存的共享状态个数, 避免重复创建信号量
+#endif
+
+namespace osal {
+
+template <typename R>
+class OSALFuture;
+
+template <typename R>
+class OSALPromise;
+
+namespace detail {
+
+// Promise与Future之间的共享状态: 结果、完成标志、等待信号量和后继任务放在同一次分配中
+// 释放后回收到按结果类型区分的缓存池, 下次直接复用(包括其中的信号量)
+template <typename R>
+class OSALFutureState {
+public:
+    using Value = std::conditional_t<std::is_void_v<R>, std::nullptr_t, R>;
+
+    static OSALFutureState *acquire() {
+        OSALFutureState *state = pool().take();
+        return state != nullptr ? state : new OSALFutureState();
+    }
+
+    void retain() { refs_.fetch_add(1, std::memory_order_relaxed); }
+
+    void release() {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            recycle();
+        }
+    }
+
+    template <typename... Args>
+    void setValue(Args &&...args) {
+        ::new (static_cast<void *>(storage_)) Value(std::forward<Args>(args)...);
+        complete(kReady | kHasValue);
+    }
+
+    // Promise未设置结果就被销毁时唤醒等待者, 此时hasValue()为false
+    void setBroken() {
+        OSAL_LOGD("Promise destroyed without a value\n");
+        complete(kReady);
+    }
+
+    bool isReady() const { return (status_.load(std::memory_order_acquire) & kReady) != 0; }
+
+    bool hasValue() const { return (status_.load(std::memory_order_acquire) & kHasValue) != 0; }
+
+    void wait() {
+        if (isReady() || (status_.fetch_or(kWaiting, std::memory_order_acq_rel) & kReady) != 0) {
+            return;
+        }
+        semaphore_.wait();
+        semaphore_.signal();  // 依次唤醒其他等待者
+    }
+
+    bool waitFor(uint32_t timeout) {
+        if (isReady() || (status_.fetch_or(kWaiting, std::memory_order_acq_rel) & kReady) != 0) {
+            return true;
+        }
+        if (!semaphore_.tryWaitFor(timeout)) {
+            return isReady();
+        }
+        semaphore_.signal();
+        return true;
+    }
+
+    Value &value() { return *std::launder(reinterpret_cast<Value *>(storage_)); }
+
+    // 设置后继任务, 以本状态指针为参数调用; 状态已完成时立即在当前线程执行, 否则在完成结果的线程执行
+    template <typename F>
+    void setContinuation(F &&continuation) {
+        continuation_ = OSALTaskFunction<>(std::forward<F>(continuation));
+        if ((status_.fetch_or(kContinuation, std::memory_order_acq_rel) & kReady) != 0) {
+            runContinuation();
+        }
+    }
+
+private:
+    enum : uint32_t {
+        kReady = 1u << 0,
+        kHasValue = 1u << 1,
+        kWaiting = 1u << 2,
+        kContinuation = 1u << 3,
+    };
+
+    class Pool {
+    public:
+        ~Pool() {
+            while (head_ != nullptr) {
+                OSALFutureState *next = head_->next_;
+                delete head_;
+                head_ = next;
+            }
+        }
+
+        OSALFutureState *take() {
+            lock_.lock();
+            OSALFutureState *state = head_;
+            if (state != nullptr) {
+                head_ = state->next_;
+                --count_;
+            }
+            lock_.unlock();
+            if (state != nullptr) {
+                state->refs_.store(1, std::memory_order_relaxed);
+            }
+            return state;
+        }
+
+        bool put(OSALFutureState *state) {
+            lock_.lock();
+            bool cached = count_ < OSAL_CONFIG_FUTURE_POOL_SIZE;
+            if (cached) {
+                state->next_ = head_;
+                head_ = state;
+                ++count_;
+            }
+            lock_.unlock();
+            return cached;
+        }
+
+    private:
+        OSALSpinLock lock_;
+        OSALFutureState *head_ = nullptr;
+        size_t count_ = 0;
+    };
+
+    static Pool &pool() {
+        static Pool instance;
+        return instance;
+    }
+
+    OSALFutureState() = default;
+
+    void complete(uint32_t flags) {
+        uint32_t previous = status_.fetch_or(flags, std::memory_order_acq_rel);
+        if ((previous & kWaiting) != 0) {
+            semaphore_.signal();
+        }
+        if ((previous & kContinuation) != 0) {
+            runContinuation();
+        }
+    }
+
+    void runContinuation() {
+        continuation_(this);
+        continuation_.reset();
+    }
+
+    void recycle() {
+        if (hasValue()) {
+            value().~Value();
+        }
+        continuation_.reset();
+        while (semaphore_.tryWait()) {
+        }
+        status_.store(0, std::memory_order_relaxed);
+        if (!pool().put(this)) {
+            delete this;
+        }
+    }
+
+    std::atomic<uint32_t> refs_{1};
+    std::atomic<uint32_t> status_{0};
+    OSALSemaphore semaphore_;
+    OSALTaskFunction<> continuation_;
+    OSALFutureState *next_ = nullptr;
+    alignas(Value) unsigned char storage_[sizeof(Value)];
+};
+
+}  // namespace detail
+
+// 异步结果的读取端, 只可移动
+template <typename R>
+class OSALFuture {
+public:
+    OSALFuture() = default;
+
+    OSALFuture(OSALFuture &&other) noexcept : state_(std::exchange(other.state_, nullptr)) {}
+
+    OSALFuture &operator=(OSALFuture &&other) noexcept {
+        if (this != &other) {
+            reset();
+            state_ = std::exchange(other.state_, nullptr);
+        }
+        return *this;
+    }
+
+    OSALFuture(const OSALFuture &) = delete;
+
+    OSALFuture &operator=(const OSALFuture &) = delete;
+
+    ~OSALFuture() { reset(); }
+
+    bool valid() const { return state_ != nullptr; }
+
+    bool isReady() const { return state_ != nullptr && state_->isReady(); }
+
+    // 已就绪且有结果, 可以调用get()
+    bool hasValue() const { return state_ != nullptr && state_->hasValue(); }
+
+    // 已就绪但promise未设置结果就被销毁(例如线程池拒绝了任务或等待空位超时), 此时不能调用get()
+    bool isBroken() const { return state_ != nullptr && state_->isReady() && !state_->hasValue(); }
+
+    void wait() const { state_->wait(); }
+
+    // 等待结果, 超时(ms)返回false
+    bool waitFor(uint32_t timeout) const { return state_->waitFor(timeout); }
+
+    // 等待并取出结果, 之后future不再有效; promise失效时中止程序, 不确定时先wait()再检查isBroken()
+    R get() {
+        state_->wait();
+        if (!state_->hasValue()) {
+            OSAL_LOGE("Future has no value: promise was broken\n");
+            std::abort();
+        }
+        if constexpr (std::is_void_v<R>) {
+            reset();
+        } else {
+            R result = std::move(state_->value());
+            reset();
+            return result;
+        }
+    }
+
+    // 结果就绪后以结果为参数执行function, 返回后继的future; 调用后本future不再有效
+    // function在完成结果的线程中执行, 若此时已就绪则在当前线程立即执行
+    template <typename F>
+    auto then(F &&function) {
+        using Result = typename std::conditional_t<std::is_void_v<R>, std::invoke_result<std::decay_t<F> &>,
+                                                   std::invoke_result<std::decay_t<F> &, R &&>>::type;
+        OSALPromise<Result> promise;
+        OSALFuture<Result> next = promise.getFuture();
+        State *state = std::exchange(state_, nullptr);
+        state->setContinuation(
+            [promise = std::move(promise), function = std::forward<F>(function)](void *argument) mutable {
+                auto *source = static_cast<State *>(argument);
+                if (!source->hasValue()) {
+                    return;  // 前驱失效, promise析构时向后传递
+                }
+                if constexpr (std::is_void_v<R>) {
+                    promise.setValueFrom(function);
+                } else {
+                    promise.setValueFrom(function, std::move(source->value()));
+                }
+            });
+        state->release();
+        return next;
+    }
+
+private:
+    using State = detail::OSALFutureState<R>;
+
+    friend class OSALPromise<R>;
+
+    explicit OSALFuture(State *state) : state_(state) {}
+
+    void reset() {
+        if (state_ != nullptr) {
+            state_->release();
+            state_ = nullptr;
+        }
+    }
+
+    State *state_ = nullptr;
+};
+
+// 异步结果的写入端, 只可移动
+template <typename R>
+class OSALPromise {
+public:
+    OSALPromise() : state_(State::acquire()) {}
+
+    OSALPromise(OSALPromise &&other) noexcept : state_(std::exchange(other.state_, nullptr)) {}
+
+    OSALPromise &operator=(OSALPromise &&other) noexcept {
+        if (this != &other) {
+            reset();
+            state_ = std::exchange(other.state_, nullptr);
+        }
+        return *this;
+    }
+
+    OSALPromise(const OSALPromise &) = delete;
+
+    OSALPromise &operator=(const OSALPromise &) = delete;
+
+    ~OSALPromise() { reset(); }
+
+    // 获取对应的future, 每个promise只应调用一次
+    OSALFuture<R> getFuture() {
+        state_->retain();
+        return OSALFuture<R>(state_);
+    }
+
+    template <typename... Args>
+    void setValue(Args &&...args) {
+        State *state = std::exchange(state_, nullptr);
+        state->setValue(std::forward<Args>(args)...);
+        state->release();
+    }
+
+    // 调用function并以其返回值完成promise
+    template <typename F, typename... Args>
+    void setValueFrom(F &function, Args &&...args) {
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(function, std::forward<Args>(args)...);
+            setValue();
+        } else {
+            setValue(std::invoke(function, std::forward<Args>(args)...));
+        }
+    }
+
+private:
+    using State = detail::OSALFutureState<R>;
+
+    void reset() {
+        if (state_ != nullptr) {
+            state_->setBroken();
+            state_->release();
+            state_ = nullptr;
+        }
+    }
+
+    State *state_;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_FUTURE_H__
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_LATCH_H__
+#define __OSAL_LATCH_H__
+
+#include <atomic>
+#include <cstddef>
+
+#include "osal_semaphore.h"
+
+namespace osal {
+
+// 一次性倒计数门闩: 计数减到0时唤醒所有等待者, 之后wait()立即返回
+class OSALLatch {
+public:
+    explicit OSALLatch(ptrdiff_t expected) : count_(expected) {
+        if (expected <= 0) {
+            count_ = 0;
+            semaphore_.signal();
+        }
+    }
+
+    OSALLatch(const OSALLatch &) = delete;
+
+    OSALLatch &operator=(const OSALLatch &) = delete;
+
+    void countDown(ptrdiff_t n = 1) {
+        if (count_.fetch_sub(n, std::memory_order_acq_rel) == n) {
+            semaphore_.signal();
+        }
+    }
+
+    bool tryWait() const { return count_.load(std::memory_order_acquire) <= 0; }
+
+    // 始终经过信号量等待, 保证返回时最后一次countDown()已不再访问本对象, 门闩可以安全销毁
+    void wait() {
+        semaphore_.wait();
+        semaphore_.signal();  // 依次唤醒其他等待者
+    }
+
+    // 等待计数归零, 超时(ms)返回false
+    bool waitFor(uint32_t timeout) {
+        if (!semaphore_.tryWaitFor(timeout)) return false;
+        semaphore_.signal();
+        return true;
+    }
+
+    void arriveAndWait(ptrdiff_t n = 1) {
+        countDown(n);
+        wait();
+    }
+
+private:
+    std::atomic<ptrdiff_t> count_;
+    OSALSemaphore semaphore_;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_LATCH_H__
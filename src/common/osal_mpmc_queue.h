@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_MPMC_QUEUE_H__
+#define __OSAL_MPMC_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "interface_queue.h"
+#include "osal_chrono.h"
+#include "osal_debug.h"
+#include "osal_semaphore.h"
+#include "osal_spin_wait.h"
+
+namespace osal {
+
+// 多生产者多消费者的有界无锁队列, 实现MessageQueue<T>接口, 最多容纳Capacity条消息(2的幂)
+// 每个槽位带一个序号: 序号等于入队下标时槽位可写, 等于入队下标+1时可读, 读出后加上Capacity留给下一圈,
+// 收发双方各自用CAS抢占下标, 不同槽位之间互不干扰
+// 只有队列空(或满)时才在自旋后阻塞, 对端只在有登记的等待者时才释放信号量
+template <typename T, size_t Capacity>
+class OSALMpmcQueue : public MessageQueue<T> {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    OSALMpmcQueue() : enqueuePos_(0), dequeuePos_(0) {
+        for (size_t i = 0; i < Capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~OSALMpmcQueue() override {
+        while (consume([](T &&) {})) {
+        }
+    }
+
+    OSALMpmcQueue(const OSALMpmcQueue &) = delete;
+
+    OSALMpmcQueue &operator=(const OSALMpmcQueue &) = delete;
+
+    using MessageQueue<T>::send;  // 保留基类的send(message, priority), 优先级被忽略
+
+    void send(const T &message) override { emplace(message); }
+
+    void send(T &&message) override { emplace(std::move(message)); }
+
+    // 在槽位中直接构造消息, 队列已满时阻塞等待空位; 参数只在构造成功时被使用一次
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        OSALSpinWait spinWait(kSpinCount, kYieldCount);
+        while (!push(std::forward<Args>(args)...)) {
+            if (!spinWait.spinOnce()) {
+                notFull_.wait([this]() { return !full(); }, kWaitForever);
+                spinWait.reset();
+            }
+        }
+        OSAL_LOGD("Message sent\n");
+    }
+
+    // 队列已满时返回false
+    bool trySend(const T &message) { return push(message); }
+
+    bool trySend(T &&message) { return push(std::move(message)); }
+
+    T receive() override {
+        std::optional<T> message;
+        OSALSpinWait spinWait(kSpinCount, kYieldCount);
+        while (!consume([&message](T &&value) { message.emplace(std::move(value)); })) {
+            if (!spinWait.spinOnce()) {
+                notEmpty_.wait([this]() { return !empty(); }, kWaitForever);
+                spinWait.reset();
+            }
+        }
+        OSAL_LOGD("Message received\n");
+        return std::move(*message);
+    }
+
+    bool tryReceive(T &message) override {
+        if (!pop(message)) {
+            return false;
+        }
+        OSAL_LOGD("Message try-received\n");
+        return true;
+    }
+
+    bool receiveFor(T &message, uint32_t timeout) override {
+        OSALChrono::TimePoint deadline = OSALChrono::getInstance().now() + timeout;
+        OSALSpinWait spinWait(kSpinCount, kYieldCount);
+        while (!pop(message)) {
+            if (spinWait.spinOnce()) continue;
+            auto remaining = static_cast<int32_t>(deadline - OSALChrono::getInstance().now());
+            if (remaining <= 0 || !notEmpty_.wait([this]() { return !empty(); }, static_cast<uint32_t>(remaining))) {
+                // 超时后再检查一次, 生产者可能刚好在超时前放入消息
+                if (!pop(message)) return false;
+                break;
+            }
+            spinWait.reset();
+        }
+        OSAL_LOGD("Message received with timeout\n");
+        return true;
+    }
+
+    // 并发收发时结果只是瞬时值
+    [[nodiscard]] size_t size() const override {
+        size_t dequeuePos = dequeuePos_.load(std::memory_order_acquire);
+        size_t enqueuePos = enqueuePos_.load(std::memory_order_acquire);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() { return Capacity; }
+
+    void clear() override {
+        while (consume([](T &&) {})) {
+        }
+        OSAL_LOGD("Message queue cleared\n");
+    }
+
+private:
+    static constexpr uint32_t kSpinCount = 128;
+    static constexpr uint32_t kYieldCount = 8;
+    static constexpr uint32_t kWaitForever = UINT32_MAX;
+    static constexpr size_t kCacheLine = 64;
+
+    // 一侧的等待者: count为已登记但尚未被唤醒的等待者数
+    class Waiters {
+    public:
+        // 信号量的积累次数需不少于同时阻塞的线程数, cmsis_os后端init()后上限为16
+        Waiters() : count_(0) { semaphore_.init(0); }
+
+        // 登记后重新检查条件, 条件仍不满足才阻塞; 返回false表示超时
+        template <typename Ready>
+        bool wait(Ready ready, uint32_t timeout) {
+            count_.fetch_add(1, std::memory_order_seq_cst);
+            if (ready()) {
+                cancel();
+                return true;
+            }
+            if (timeout == kWaitForever) {
+                semaphore_.wait();
+                return true;
+            }
+            if (semaphore_.tryWaitFor(timeout)) return true;
+            cancel();
+            return false;
+        }
+
+        // 对端改变队列状态后调用, 有等待者时认领一个并唤醒
+        void notify() {
+            uint32_t count = count_.load(std::memory_order_seq_cst);
+            while (count > 0) {
+                if (count_.compare_exchange_weak(count, count - 1, std::memory_order_seq_cst)) {
+                    semaphore_.signal();
+                    return;
+                }
+            }
+        }
+
+    private:
+        // 撤销登记; 登记已全部被认领时, 说明对端已经或即将为本线程释放一次信号量, 需取走这次释放
+        void cancel() {
+            uint32_t count = count_.load(std::memory_order_relaxed);
+            while (count > 0) {
+                if (count_.compare_exchange_weak(count, count - 1, std::memory_order_relaxed)) return;
+            }
+            semaphore_.wait();
+        }
+
+        std::atomic<uint32_t> count_;
+        OSALSemaphore semaphore_;
+    };
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T *value() { return reinterpret_cast<T *>(storage); }
+    };
+
+    template <typename... Args>
+    bool push(Args &&...args) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true) {
+            cell = &cells_[pos & (Capacity - 1)];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // 槽位还没被上一圈的消费者取走, 队列已满
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        std::construct_at(cell->value(), std::forward<Args>(args)...);
+        // seq_cst写与等待者登记后的seq_cst检查配对, 保证不会双方都错过对方
+        cell->sequence.store(pos + 1, std::memory_order_seq_cst);
+        notEmpty_.notify();
+        return true;
+    }
+
+    bool pop(T &message) {
+        return consume([&message](T &&value) { message = std::move(value); });
+    }
+
+    // 取出一条消息交给sink, 消息类型不需要默认构造
+    template <typename Sink>
+    bool consume(Sink &&sink) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true) {
+            cell = &cells_[pos & (Capacity - 1)];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // 槽位还没被写入, 队列为空
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        sink(std::move(*cell->value()));
+        std::destroy_at(cell->value());
+        cell->sequence.store(pos + Capacity, std::memory_order_seq_cst);
+        notFull_.notify();
+        return true;
+    }
+
+    // 等待者登记后的检查; 读到的下标已被其他线程越过时重新读取, 以免把已越过的槽位误判为空(或满)
+    [[nodiscard]] bool empty() const {
+        while (true) {
+            size_t pos = dequeuePos_.load(std::memory_order_seq_cst);
+            size_t sequence = cells_[pos & (Capacity - 1)].sequence.load(std::memory_order_seq_cst);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff <= 0) return diff < 0;
+        }
+    }
+
+    [[nodiscard]] bool full() const {
+        while (true) {
+            size_t pos = enqueuePos_.load(std::memory_order_seq_cst);
+            size_t sequence = cells_[pos & (Capacity - 1)].sequence.load(std::memory_order_seq_cst);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff <= 0) return diff < 0;
+        }
+    }
+
+    alignas(kCacheLine) std::atomic<size_t> enqueuePos_;
+    alignas(kCacheLine) std::atomic<size_t> dequeuePos_;
+    alignas(kCacheLine) Waiters notEmpty_;
+    alignas(kCacheLine) Waiters notFull_;
+    alignas(kCacheLine) Cell cells_[Capacity];
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_MPMC_QUEUE_H__
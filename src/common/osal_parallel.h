@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_PARALLEL_H__
+#define __OSAL_PARALLEL_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "osal_latch.h"
+#include "osal_thread_pool.h"
+
+namespace osal {
+
+namespace detail {
+
+// 并行区间的共享状态, 由调用线程和辅助任务共同持有
+// 迟到的辅助任务只会发现区间已领取完毕, 不会访问调用线程栈上已经失效的对象
+template <typename I>
+class OSALParallelRange {
+public:
+    OSALParallelRange(I begin, I end, size_t grain, uint32_t participants)
+        : next_(begin), end_(end), grain_(grain), participants_(participants),
+          done_(static_cast<ptrdiff_t>(end - begin)) {}
+
+    // 领取下一块区间: 剩余越多块越大, 临近结束时缩小到grain, 兼顾调度开销与负载均衡
+    bool claim(I &chunkBegin, I &chunkEnd) {
+        I current = next_.load(std::memory_order_relaxed);
+        while (current < end_) {
+            size_t remaining = static_cast<size_t>(end_ - current);
+            size_t size = std::min(remaining, std::max(grain_, remaining / (2 * participants_)));
+            I stop = static_cast<I>(current + static_cast<I>(size));
+            if (next_.compare_exchange_weak(current, stop, std::memory_order_relaxed)) {
+                chunkBegin = current;
+                chunkEnd = stop;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 一个参与者领取并处理区间直到取完, body(participant, chunkBegin, chunkEnd)
+    template <typename Body>
+    void participate(uint32_t participant, Body &body) {
+        I chunkBegin, chunkEnd;
+        ptrdiff_t processed = 0;
+        while (claim(chunkBegin, chunkEnd)) {
+            body(participant, chunkBegin, chunkEnd);
+            processed += static_cast<ptrdiff_t>(chunkEnd - chunkBegin);
+        }
+        if (processed > 0) {
+            done_.countDown(processed);
+        }
+    }
+
+    void wait() { done_.wait(); }
+
+private:
+    std::atomic<I> next_;
+    const I end_;
+    const size_t grain_;
+    const uint32_t participants_;
+    OSALLatch done_;  // 按已处理元素数倒计数, 不依赖辅助任务是否被调度
+};
+
+// 参与的辅助任务数: 不超过线程池线程数, 也不超过按grain切分后的块数减一(调用线程自身也参与)
+inline uint32_t parallelHelpers(OSALThreadPool &pool, size_t count, size_t grain) {
+    size_t chunks = (count + grain - 1) / grain;
+    return static_cast<uint32_t>(std::min<size_t>(std::max<uint32_t>(pool.getMaxThreads(), 1), chunks - 1));
+}
+
+// 未指定grain时按每个参与者约8块自动选择
+inline size_t parallelGrain(OSALThreadPool &pool, size_t count, size_t grain) {
+    if (grain > 0) return grain;
+    return std::max<size_t>(1, count / (8 * (std::max<uint32_t>(pool.getMaxThreads(), 1) + 1)));
+}
+
+template <typename I, typename Body>
+void parallelRun(OSALThreadPool &pool, I begin, I end, size_t grain, uint32_t helpers, Body &body) {
+    auto range = std::make_shared<OSALParallelRange<I>>(begin, end, grain, helpers + 1);
+    if (helpers > 0) {
+        std::vector<OSALThreadPool::Task> tasks;
+        tasks.reserve(helpers);
+        for (uint32_t i = 1; i <= helpers; ++i) {
+            tasks.push_back(OSALThreadPool::Task{[range, &body, i]() { range->participate(i, body); }, nullptr, 0});
+        }
+        pool.submitBatch(std::span<OSALThreadPool::Task>(tasks));
+    }
+    range->participate(0, body);
+    range->wait();
+}
+
+}  // namespace detail
+
+// 并行执行[begin, end)区间, function(i)逐个处理, 或function(chunkBegin, chunkEnd)按块处理
+// grain为最小块大小, 0表示自动选择; 调用线程参与计算, 返回时所有元素均已处理完毕
+template <typename I, typename F>
+void parallelFor(OSALThreadPool &pool, I begin, std::type_identity_t<I> end, size_t grain, F &&function) {
+    static_assert(std::is_integral_v<I>, "parallelFor requires an integral index type");
+    if (!(begin < end)) return;
+    size_t count = static_cast<size_t>(end - begin);
+    grain = detail::parallelGrain(pool, count, grain);
+    auto body = [&function](uint32_t, I chunkBegin, I chunkEnd) {
+        if constexpr (std::is_invocable_v<F &, I, I>) {
+            function(chunkBegin, chunkEnd);
+        } else {
+            for (I i = chunkBegin; i < chunkEnd; ++i) {
+                function(i);
+            }
+        }
+    };
+    detail::parallelRun(pool, begin, end, grain, detail::parallelHelpers(pool, count, grain), body);
+}
+
+// 并行归约[begin, end)区间: function(i)或function(chunkBegin, chunkEnd)返回部分结果, 用combine合并
+// combine需满足结合律和交换律, 各参与者先在本地累积, 最后由调用线程合并
+template <typename I, typename T, typename F, typename Combine>
+T parallelReduce(OSALThreadPool &pool, I begin, std::type_identity_t<I> end, size_t grain, T identity,
+                 F &&function, Combine &&combine) {
+    static_assert(std::is_integral_v<I>, "parallelReduce requires an integral index type");
+    if (!(begin < end)) return identity;
+    size_t count = static_cast<size_t>(end - begin);
+    grain = detail::parallelGrain(pool, count, grain);
+    uint32_t helpers = detail::parallelHelpers(pool, count, grain);
+
+    // 每个参与者独占一个按缓存行对齐的累积槽, 避免伪共享
+    struct alignas(64) Slot {
+        T value;
+    };
+    std::vector<Slot> partials(helpers + 1, Slot{identity});
+    auto body = [&function, &combine, &partials](uint32_t participant, I chunkBegin, I chunkEnd) {
+        T &value = partials[participant].value;
+        if constexpr (std::is_invocable_v<F &, I, I>) {
+            value = combine(std::move(value), function(chunkBegin, chunkEnd));
+        } else {
+            for (I i = chunkBegin; i < chunkEnd; ++i) {
+                value = combine(std::move(value), function(i));
+            }
+        }
+    };
+    detail::parallelRun(pool, begin, end, grain, helpers, body);
+
+    T result = std::move(identity);
+    for (auto &partial : partials) {
+        result = combine(std::move(result), std::move(partial.value));
+    }
+    return result;
+}
+
+// 并行变换: *(out + i) = function(*(first + i)), 要求随机访问迭代器, 返回输出区间的末尾
+template <typename InputIt, typename OutputIt, typename F>
+OutputIt parallelTransform(OSALThreadPool &pool, InputIt first, InputIt last, OutputIt out, size_t grain,
+                           F &&function) {
+    static_assert(std::random_access_iterator<InputIt> && std::random_access_iterator<OutputIt>,
+                  "parallelTransform requires random access iterators");
+    ptrdiff_t count = std::distance(first, last);
+    parallelFor(pool, ptrdiff_t{0}, count, grain, [&](ptrdiff_t chunkBegin, ptrdiff_t chunkEnd) {
+        for (ptrdiff_t i = chunkBegin; i < chunkEnd; ++i) {
+            out[i] = function(first[i]);
+        }
+    });
+    return out + count;
+}
+
+}  // namespace osal
+
+#endif  // __OSAL_PARALLEL_H__
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_PRIORITY_BUCKET_QUEUE_H__
+#define __OSAL_PRIORITY_BUCKET_QUEUE_H__
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "osal.h"
+#include "osal_ring_buffer.h"
+
+#ifndef OSAL_CONFIG_THREAD_POOL_PRIORITY_LEVELS
+#define OSAL_CONFIG_THREAD_POOL_PRIORITY_LEVELS 8  // 线程池任务优先级级数, 最大32
+#endif
+
+namespace osal {
+
+// 分桶优先级队列: 每个优先级一个FIFO桶, 用位图记录非空桶, 入队和出队均为O(1)
+// 优先级数值越大越先出队, 超出范围的优先级被限制到[0, Levels - 1]
+template <typename T, size_t Levels = OSAL_CONFIG_THREAD_POOL_PRIORITY_LEVELS>
+class OSALPriorityBucketQueue {
+    static_assert(Levels > 0 && Levels <= 32, "priority levels must be in [1, 32]");
+
+public:
+    static constexpr size_t levelOf(int priority) {
+        if (priority < 0) return 0;
+        return static_cast<size_t>(priority) < Levels ? static_cast<size_t>(priority) : Levels - 1;
+    }
+
+    // timestamp为入队时间, 仅在启用老化时使用
+    void push(T &&value, int priority, uint32_t timestamp = 0) { emplace(priority, timestamp, std::move(value)); }
+
+    // 在对应优先级的桶中直接构造元素
+    template <typename... Args>
+    void emplace(int priority, uint32_t timestamp, Args &&...args) {
+        size_t level = levelOf(priority);
+        buckets_[level].emplaceBack(timestamp, std::forward<Args>(args)...);
+        mask_ |= (1u << level);
+        ++size_;
+    }
+
+    // 弹出优先级最高的元素
+    // agingInterval > 0 时启用老化: 元素每等待agingInterval, 其有效优先级提升一级, 防止低优先级任务饿死
+    bool pop(T &value, uint32_t now = 0, uint32_t agingInterval = 0) {
+        if (mask_ == 0) {
+            return false;
+        }
+        value = popFront(now, agingInterval);
+        return true;
+    }
+
+    // 同pop(), 直接返回元素, 元素类型不需要默认构造; 调用方需保证队列非空
+    T popFront(uint32_t now = 0, uint32_t agingInterval = 0) {
+        size_t level = static_cast<size_t>(std::bit_width(mask_)) - 1;
+        if (agingInterval > 0) {
+            level = agedLevel(level, now, agingInterval);
+        }
+        return takeFrom(level);
+    }
+
+    // 弹出优先级最低的桶中最早入队的元素, 即最后才会被执行的元素中等待最久的一个, 用于队列满时丢弃
+    bool popLowest(T &value) {
+        if (mask_ == 0) {
+            return false;
+        }
+        value = takeFrom(static_cast<size_t>(std::countr_zero(mask_)));
+        return true;
+    }
+
+    // 删除所有满足条件的元素, 返回删除的数量
+    template <typename Predicate>
+    size_t removeIf(Predicate predicate) {
+        size_t removed = 0;
+        for (size_t level = 0; level < Levels; ++level) {
+            auto &bucket = buckets_[level];
+            removed += bucket.removeIf([&predicate](Entry &entry) { return predicate(entry.value); });
+            if (bucket.empty()) {
+                mask_ &= ~(1u << level);
+            }
+        }
+        size_ -= removed;
+        return removed;
+    }
+
+    // 返回各桶队首元素中最长的等待时间(与timestamp同单位), 队列为空时返回0
+    [[nodiscard]] uint32_t longestWait(uint32_t now) const {
+        uint32_t longest = 0;
+        for (uint32_t mask = mask_; mask != 0; mask &= mask - 1) {
+            size_t level = static_cast<size_t>(std::countr_zero(mask));
+            longest = std::max(longest, now - buckets_[level].front().timestamp);
+        }
+        return longest;
+    }
+
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+
+    [[nodiscard]] size_t size() const { return size_; }
+
+    void clear() {
+        for (auto &bucket : buckets_) {
+            bucket.clear();
+        }
+        mask_ = 0;
+        size_ = 0;
+    }
+
+private:
+    struct Entry {
+        template <typename... Args>
+        explicit Entry(uint32_t time, Args &&...args) : value(make(std::forward<Args>(args)...)), timestamp(time) {}
+
+        // 有匹配的构造函数时用圆括号构造(与标准容器的emplace一致, 如vector(n, value)), 否则按聚合初始化
+        template <typename... Args>
+        static T make(Args &&...args) {
+            if constexpr (std::is_constructible_v<T, Args...>) {
+                return T(std::forward<Args>(args)...);
+            } else {
+                return T{std::forward<Args>(args)...};
+            }
+        }
+
+        T value;
+        uint32_t timestamp;
+    };
+
+    T takeFrom(size_t level) {
+        auto &bucket = buckets_[level];
+        T value = std::move(bucket.front().value);
+        bucket.popFront();
+        if (bucket.empty()) {
+            mask_ &= ~(1u << level);
+        }
+        --size_;
+        return value;
+    }
+
+    // 比较各非空桶队首元素的有效优先级(级别 + 等待时间 / 老化间隔), 桶数固定, 开销为常数
+    size_t agedLevel(size_t highest, uint32_t now, uint32_t agingInterval) const {
+        size_t best = highest;
+        uint32_t bestScore = static_cast<uint32_t>(highest);
+        for (size_t level = 0; level < highest; ++level) {
+            if ((mask_ & (1u << level)) == 0) continue;
+            uint32_t waited = now - buckets_[level].front().timestamp;
+            uint32_t score = static_cast<uint32_t>(level) + waited / agingInterval;
+            if (score > bestScore) {
+                best = level;
+                bestScore = score;
+            }
+        }
+        return best;
+    }
+
+    OSALRingBuffer<Entry> buckets_[Levels];
+    uint32_t mask_ = 0;  // 第i位表示第i级桶非空
+    size_t size_ = 0;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_PRIORITY_BUCKET_QUEUE_H__
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_RING_BUFFER_H__
+#define __OSAL_RING_BUFFER_H__
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace osal {
+
+// 可增长的环形缓冲区, 支持两端弹出; 容量为2的幂, 只在容量不足时重新分配,
+// 稳定运行后入队出队不再产生堆分配
+template <typename T>
+class OSALRingBuffer {
+public:
+    OSALRingBuffer() = default;
+
+    explicit OSALRingBuffer(size_t capacity) { reserve(capacity); }
+
+    OSALRingBuffer(OSALRingBuffer &&other) noexcept
+        : data_(other.data_), capacity_(other.capacity_), head_(other.head_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.capacity_ = other.head_ = other.size_ = 0;
+    }
+
+    OSALRingBuffer &operator=(OSALRingBuffer &&other) noexcept {
+        if (this != &other) {
+            release();
+            std::swap(data_, other.data_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(head_, other.head_);
+            std::swap(size_, other.size_);
+        }
+        return *this;
+    }
+
+    OSALRingBuffer(const OSALRingBuffer &) = delete;
+
+    OSALRingBuffer &operator=(const OSALRingBuffer &) = delete;
+
+    ~OSALRingBuffer() { release(); }
+
+    template <typename... Args>
+    T &emplaceBack(Args &&...args) {
+        if (size_ == capacity_) {
+            reserve(capacity_ == 0 ? kMinCapacity : capacity_ * 2);
+        }
+        T *slot = at(size_);
+        std::construct_at(slot, std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    void pushBack(T &&value) { emplaceBack(std::move(value)); }
+
+    T &front() { return *at(0); }
+
+    const T &front() const { return *at(0); }
+
+    T &back() { return *at(size_ - 1); }
+
+    void popFront() {
+        std::destroy_at(at(0));
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --size_;
+    }
+
+    void popBack() {
+        std::destroy_at(at(size_ - 1));
+        --size_;
+    }
+
+    // 删除所有满足条件的元素并保持其余元素的顺序, 返回删除的数量
+    template <typename Predicate>
+    size_t removeIf(Predicate predicate) {
+        size_t kept = 0;
+        for (size_t i = 0; i < size_; ++i) {
+            T *element = at(i);
+            if (predicate(*element)) continue;
+            if (kept != i) {
+                *at(kept) = std::move(*element);
+            }
+            ++kept;
+        }
+        size_t removed = size_ - kept;
+        while (size_ > kept) {
+            popBack();
+        }
+        return removed;
+    }
+
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+
+    [[nodiscard]] size_t size() const { return size_; }
+
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+    void clear() {
+        while (size_ > 0) {
+            popBack();
+        }
+        head_ = 0;
+    }
+
+    // 预留至少capacity个元素的空间(向上取整为2的幂)
+    void reserve(size_t capacity) {
+        if (capacity <= capacity_) return;
+        size_t newCapacity = kMinCapacity;
+        while (newCapacity < capacity) {
+            newCapacity *= 2;
+        }
+        std::allocator<T> allocator;
+        T *newData = allocator.allocate(newCapacity);
+        for (size_t i = 0; i < size_; ++i) {
+            T *element = at(i);
+            std::construct_at(newData + i, std::move(*element));
+            std::destroy_at(element);
+        }
+        if (data_ != nullptr) {
+            allocator.deallocate(data_, capacity_);
+        }
+        data_ = newData;
+        capacity_ = newCapacity;
+        head_ = 0;
+    }
+
+private:
+    static constexpr size_t kMinCapacity = 8;
+
+    T *at(size_t index) const { return data_ + ((head_ + index) & (capacity_ - 1)); }
+
+    void release() {
+        clear();
+        if (data_ != nullptr) {
+            std::allocator<T>().deallocate(data_, capacity_);
+            data_ = nullptr;
+            capacity_ = 0;
+        }
+    }
+
+    T *data_ = nullptr;
+    size_t capacity_ = 0;
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_RING_BUFFER_H__
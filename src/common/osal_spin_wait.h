@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_SPIN_WAIT_H__
+#define __OSAL_SPIN_WAIT_H__
+
+#include <cstdint>
+
+#include "osal_system.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace osal {
+
+// 自旋等待时的CPU提示指令: x86为pause, ARM为yield, 降低自旋对流水线和同核超线程的影响
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// 分阶段的自旋等待: 前spinCount步执行cpuRelax(), 之后yieldCount步让出CPU, 两个阶段都结束后由调用方休眠
+class OSALSpinWait {
+public:
+    OSALSpinWait(uint32_t spinCount, uint32_t yieldCount) : spinCount_(spinCount), yieldCount_(yieldCount), step_(0) {}
+
+    // 执行一步等待, 返回false表示自旋和让出阶段均已结束
+    bool spinOnce() {
+        if (step_ < spinCount_) {
+            cpuRelax();
+        } else if (step_ - spinCount_ < yieldCount_) {
+            OSALSystem::getInstance().yield();
+        } else {
+            return false;
+        }
+        ++step_;
+        return true;
+    }
+
+    void reset() { step_ = 0; }
+
+private:
+    uint32_t spinCount_;
+    uint32_t yieldCount_;
+    uint32_t step_;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_SPIN_WAIT_H__
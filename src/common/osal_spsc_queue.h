@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_SPSC_QUEUE_H__
+#define __OSAL_SPSC_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "interface_queue.h"
+#include "osal_chrono.h"
+#include "osal_debug.h"
+#include "osal_semaphore.h"
+#include "osal_spin_wait.h"
+
+namespace osal {
+
+// 单生产者单消费者的无锁环形队列, 实现MessageQueue<T>接口, 最多容纳Capacity条消息(2的幂)
+// 只允许一个线程调用send/trySend, 另一个线程调用receive/tryReceive/receiveFor/clear
+// 收发两端的下标各占一条缓存行, 并缓存对端下标, 只在缓存值显示队列空或满时才读取对端的缓存行;
+// 队列空(或满)时先自旋等待, 仍无消息才登记等待标志并阻塞在信号量上, 对端只在看到等待标志时才释放信号量,
+// 因此稳定收发时不进入内核
+template <typename T, size_t Capacity>
+class OSALSpscQueue : public MessageQueue<T> {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    OSALSpscQueue() : head_(0), cachedTail_(0), tail_(0), cachedHead_(0) {}
+
+    ~OSALSpscQueue() override { consume(Capacity, [](T &&) {}); }
+
+    OSALSpscQueue(const OSALSpscQueue &) = delete;
+
+    OSALSpscQueue &operator=(const OSALSpscQueue &) = delete;
+
+    using MessageQueue<T>::send;  // 保留基类的send(message, priority), 优先级被忽略
+
+    void send(const T &message) override { emplace(message); }
+
+    void send(T &&message) override { emplace(std::move(message)); }
+
+    // 在槽位中直接构造消息, 队列已满时阻塞等待消费者取走消息; 参数只在构造成功时被使用一次
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        OSALSpinWait spinWait(kSpinCount, kYieldCount);
+        while (!push(std::forward<Args>(args)...)) {
+            if (!spinWait.spinOnce()) {
+                waitNotFull();
+                spinWait.reset();
+            }
+        }
+        OSAL_LOGD("Message sent\n");
+    }
+
+    // 队列已满时返回false
+    bool trySend(const T &message) { return push(message); }
+
+    bool trySend(T &&message) { return push(std::move(message)); }
+
+    T receive() override {
+        std::optional<T> message;
+        OSALSpinWait spinWait(kSpinCount, kYieldCount);
+        while (consume(1, [&message](T &&value) { message.emplace(std::move(value)); }) == 0) {
+            if (!spinWait.spinOnce()) {
+                waitNotEmpty(kWaitForever);
+                spinWait.reset();
+            }
+        }
+        OSAL_LOGD("Message received\n");
+        return std::move(*message);
+    }
+
+    bool tryReceive(T &message) override {
+        if (!pop(message)) {
+            return false;
+        }
+        OSAL_LOGD("Message try-received\n");
+        return true;
+    }
+
+    bool receiveFor(T &message, uint32_t timeout) override {
+        OSALChrono::TimePoint deadline = OSALChrono::getInstance().now() + timeout;
+        OSALSpinWait spinWait(kSpinCount, kYieldCount);
+        while (!pop(message)) {
+            if (spinWait.spinOnce()) continue;
+            auto remaining = static_cast<int32_t>(deadline - OSALChrono::getInstance().now());
+            if (remaining <= 0 || !waitNotEmpty(static_cast<uint32_t>(remaining))) {
+                // 超时后再检查一次, 生产者可能刚好在超时前放入消息
+                if (!pop(message)) return false;
+                break;
+            }
+            spinWait.reset();
+        }
+        OSAL_LOGD("Message received with timeout\n");
+        return true;
+    }
+
+    // 一次取出多条消息, 整批只更新一次消费者下标
+    size_t receiveBatch(T *out, size_t maxCount) override { return popBatch(out, maxCount); }
+
+    // 两端并发运行时结果只是瞬时值
+    [[nodiscard]] size_t size() const override {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() { return Capacity; }
+
+    // 由消费者线程调用
+    void clear() override {
+        consume(Capacity, [](T &&) {});
+        OSAL_LOGD("Message queue cleared\n");
+    }
+
+private:
+    static constexpr uint32_t kSpinCount = 128;
+    static constexpr uint32_t kYieldCount = 8;
+    static constexpr uint32_t kWaitForever = UINT32_MAX;
+    static constexpr size_t kCacheLine = 64;
+
+    T *slot(size_t index) { return reinterpret_cast<T *>(storage_[index & (Capacity - 1)]); }
+
+    // 生产者侧: 缓存的head显示已满时才重新读取消费者下标
+    template <typename... Args>
+    bool push(Args &&...args) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ == Capacity) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ == Capacity) return false;
+        }
+        std::construct_at(slot(tail), std::forward<Args>(args)...);
+        // seq_cst写与下面对等待标志的seq_cst读配对, 与消费者登记等待的顺序相反, 保证不会双方都错过对方
+        tail_.store(tail + 1, std::memory_order_seq_cst);
+        if (consumerWaiting_.load(std::memory_order_seq_cst) && consumerWaiting_.exchange(false)) {
+            notEmpty_.signal();
+        }
+        return true;
+    }
+
+    bool pop(T &message) { return popBatch(&message, 1) == 1; }
+
+    size_t popBatch(T *out, size_t maxCount) {
+        return consume(maxCount, [&out](T &&value) { *out++ = std::move(value); });
+    }
+
+    // 消费者侧: 取出最多maxCount条消息依次交给sink, 消息类型不需要默认构造;
+    // 缓存的tail显示消息不足时才重新读取生产者下标, 整批只发布一次head
+    template <typename Sink>
+    size_t consume(size_t maxCount, Sink &&sink) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (cachedTail_ - head < maxCount) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+        }
+        size_t count = cachedTail_ - head < maxCount ? cachedTail_ - head : maxCount;
+        if (count == 0) return 0;
+        for (size_t i = 0; i < count; ++i) {
+            T *item = slot(head + i);
+            sink(std::move(*item));
+            std::destroy_at(item);
+        }
+        head_.store(head + count, std::memory_order_seq_cst);
+        if (producerWaiting_.load(std::memory_order_seq_cst) && producerWaiting_.exchange(false)) {
+            notFull_.signal();
+        }
+        return count;
+    }
+
+    // 登记等待后重新检查队列, 仍为空才阻塞; 返回false表示超时
+    bool waitNotEmpty(uint32_t timeout) {
+        consumerWaiting_.store(true, std::memory_order_seq_cst);
+        if (tail_.load(std::memory_order_seq_cst) != head_.load(std::memory_order_relaxed)) {
+            cancelWait(consumerWaiting_, notEmpty_);
+            return true;
+        }
+        if (timeout == kWaitForever) {
+            notEmpty_.wait();
+            return true;
+        }
+        if (notEmpty_.tryWaitFor(timeout)) return true;
+        cancelWait(consumerWaiting_, notEmpty_);
+        return false;
+    }
+
+    void waitNotFull() {
+        producerWaiting_.store(true, std::memory_order_seq_cst);
+        if (tail_.load(std::memory_order_relaxed) - head_.load(std::memory_order_seq_cst) != Capacity) {
+            cancelWait(producerWaiting_, notFull_);
+            return;
+        }
+        notFull_.wait();
+    }
+
+    // 撤销等待标志; 若对端已清除标志, 说明它已经或即将释放信号量, 需取走这次释放, 避免留到下次等待
+    static void cancelWait(std::atomic<bool> &waiting, OSALSemaphore &semaphore) {
+        if (!waiting.exchange(false)) {
+            semaphore.wait();
+        }
+    }
+
+    // 消费者独占的缓存行
+    alignas(kCacheLine) std::atomic<size_t> head_;
+    size_t cachedTail_;
+    // 生产者独占的缓存行
+    alignas(kCacheLine) std::atomic<size_t> tail_;
+    size_t cachedHead_;
+    // 等待标志很少被写入, 对端读取时通常命中共享状态的缓存行
+    alignas(kCacheLine) std::atomic<bool> consumerWaiting_{false};
+    std::atomic<bool> producerWaiting_{false};
+    OSALSemaphore notEmpty_;
+    OSALSemaphore notFull_;
+    alignas(kCacheLine) alignas(T) unsigned char storage_[Capacity][sizeof(T)];
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_SPSC_QUEUE_H__
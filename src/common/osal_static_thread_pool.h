@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_STATIC_THREAD_POOL_H__
+#define __OSAL_STATIC_THREAD_POOL_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "interface_thread_pool.h"
+#include "osal.h"
+#include "osal_condition_variable.h"
+#include "osal_debug.h"
+#include "osal_lockguard.h"
+#include "osal_mutex.h"
+#include "osal_task_function.h"
+#include "osal_thread.h"
+
+#ifndef OSAL_CONFIG_STATIC_THREAD_POOL_STACK_SIZE
+#define OSAL_CONFIG_STATIC_THREAD_POOL_STACK_SIZE 4096  // 静态线程池每个工作线程的栈大小(字节)
+#endif
+
+namespace osal {
+
+// 编译期定长的静态线程池: Workers个工作线程, 最多QueueDepth个排队任务, 每个任务闭包不超过TaskBytes
+// 任务槽位是对象内预分配的环形缓冲区, 工作线程栈也放在对象内并通过pstack传给线程, 适合放在静态存储区;
+// 构造和start()时由RTOS创建线程、互斥锁等内核对象, 之后提交和执行任务都不再访问堆
+// 闭包超过TaskBytes时编译失败, 而不是像OSALThreadPool一样退化为堆上存储
+template <uint32_t Workers, size_t QueueDepth, size_t TaskBytes = OSAL_CONFIG_TASK_INLINE_SIZE,
+          size_t StackBytes = OSAL_CONFIG_STATIC_THREAD_POOL_STACK_SIZE>
+class OSALStaticThreadPool {
+    static_assert(Workers > 0, "Workers must be positive");
+    static_assert(QueueDepth > 0, "QueueDepth must be positive");
+
+public:
+    using TaskFunction = OSALTaskFunction<TaskBytes>;
+
+    // 判断可调用对象能否存入任务槽位
+    template <typename F>
+    static constexpr bool fitsSlot = TaskFunction::template isInline<std::decay_t<F>>;
+
+    OSALStaticThreadPool() : head_(0), count_(0), idleWorkers_(0), blockedSubmitters_(0), started_(false) {}
+
+    ~OSALStaticThreadPool() { stop(); }
+
+    OSALStaticThreadPool(const OSALStaticThreadPool &) = delete;
+
+    OSALStaticThreadPool &operator=(const OSALStaticThreadPool &) = delete;
+
+    // 启动全部工作线程, 任一线程创建失败时停止已创建的线程并返回false
+    bool start(int priority = OSAL_CONFIG_THREAD_DEFAULT_PRIORITY) {
+        if (started_) return true;
+        started_ = true;
+        for (uint32_t i = 0; i < Workers; ++i) {
+            if (workers_[i].start("StaticThreadPool", threadEntry, this, priority, static_cast<int>(StackBytes),
+                                  stacks_[i]) != 0) {
+                OSAL_LOGE("Failed to start static thread pool worker %u\n", i);
+                stop();
+                return false;
+            }
+        }
+        OSAL_LOGD("Static thread pool started with %u threads\n", Workers);
+        return true;
+    }
+
+    // 停止线程池: 工作线程执行完已排队的任务后退出, 等待提交的线程返回Rejected
+    void stop() {
+        {
+            OSALLockGuard lockGuard(mutex_);
+            if (!started_) return;
+            started_ = false;
+            notEmpty_.notifyAll();
+            notFull_.notifyAll();
+        }
+        for (auto &worker : workers_) {
+            worker.join();  // 未启动的线程join()直接返回
+        }
+        OSAL_LOGD("Static thread pool stopped\n");
+    }
+
+    [[nodiscard]] bool isStarted() const { return started_; }
+
+    // 提交任务, function为无参或以void*为参数(传入nullptr)的可调用对象; 队列已满时阻塞等待空位
+    // 线程池未启动时返回Rejected
+    template <typename F, typename = std::enable_if_t<TaskFunction::template isCallable<std::decay_t<F>>>>
+    ThreadPoolSubmitStatus post(F &&function) {
+        static_assert(fitsSlot<F>, "Task closure exceeds TaskBytes and would be heap allocated");
+        OSALLockGuard lockGuard(mutex_);
+        while (count_ == QueueDepth && started_) {
+            ++blockedSubmitters_;
+            notFull_.wait(mutex_);
+            --blockedSubmitters_;
+        }
+        if (!started_) return ThreadPoolSubmitStatus::Rejected;
+        pushLocked(std::forward<F>(function));
+        return ThreadPoolSubmitStatus::Accepted;
+    }
+
+    // 提交任务, 队列已满或线程池未启动时立即返回Rejected, 不阻塞
+    template <typename F, typename = std::enable_if_t<TaskFunction::template isCallable<std::decay_t<F>>>>
+    ThreadPoolSubmitStatus tryPost(F &&function) {
+        static_assert(fitsSlot<F>, "Task closure exceeds TaskBytes and would be heap allocated");
+        OSALLockGuard lockGuard(mutex_);
+        if (count_ == QueueDepth || !started_) return ThreadPoolSubmitStatus::Rejected;
+        pushLocked(std::forward<F>(function));
+        return ThreadPoolSubmitStatus::Accepted;
+    }
+
+    // 排队中的任务数
+    [[nodiscard]] size_t getTaskQueueSize() {
+        OSALLockGuard lockGuard(mutex_);
+        return count_;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() { return QueueDepth; }
+
+    [[nodiscard]] static constexpr uint32_t workerCount() { return Workers; }
+
+private:
+    // 调用方持有mutex_; 只在有线程等待时通知, 基于信号量的条件变量不会积累多余的计数
+    template <typename F>
+    void pushLocked(F &&function) {
+        slots_[(head_ + count_) % QueueDepth] = TaskFunction(std::forward<F>(function));
+        ++count_;
+        if (idleWorkers_ > 0) {
+            notEmpty_.notifyOne();
+        }
+    }
+
+    static void threadEntry(void *arg) { static_cast<OSALStaticThreadPool *>(arg)->threadLoop(); }
+
+    void threadLoop() {
+        while (true) {
+            TaskFunction task;
+            {
+                OSALLockGuard lockGuard(mutex_);
+                while (count_ == 0 && started_) {
+                    ++idleWorkers_;
+                    notEmpty_.wait(mutex_);
+                    --idleWorkers_;
+                }
+                if (count_ == 0) break;  // 已停止且队列已清空
+                task = std::move(slots_[head_]);
+                head_ = (head_ + 1) % QueueDepth;
+                --count_;
+                if (blockedSubmitters_ > 0) {
+                    notFull_.notifyOne();
+                }
+            }
+            task(nullptr);
+        }
+    }
+
+    OSALMutex mutex_;
+    OSALConditionVariable notEmpty_;  // 队列非空时唤醒工作线程, 配合mutex_使用
+    OSALConditionVariable notFull_;   // 队列出现空位时唤醒被阻塞的提交线程
+    TaskFunction slots_[QueueDepth];  // 任务槽位环形缓冲区, 由mutex_保护
+    size_t head_;                     // 最早排队任务所在的槽位
+    size_t count_;                    // 排队中的任务数
+    uint32_t idleWorkers_;            // 正在等待任务的工作线程数, 由mutex_保护
+    uint32_t blockedSubmitters_;      // 正在等待空位的提交线程数, 由mutex_保护
+    volatile bool started_;
+    OSALThread workers_[Workers];
+    alignas(16) uint8_t stacks_[Workers][StackBytes];  // 工作线程栈
+};
+
+// 与请求中的命名保持一致的别名
+template <uint32_t Workers, size_t QueueDepth, size_t TaskBytes = OSAL_CONFIG_TASK_INLINE_SIZE,
+          size_t StackBytes = OSAL_CONFIG_STATIC_THREAD_POOL_STACK_SIZE>
+using StaticThreadPool = OSALStaticThreadPool<Workers, QueueDepth, TaskBytes, StackBytes>;
+
+}  // namespace osal
+
+#endif  // __OSAL_STATIC_THREAD_POOL_H__
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_STRAND_H__
+#define __OSAL_STRAND_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "osal_future.h"
+#include "osal_spin_wait.h"
+#include "osal_task_function.h"
+#include "osal_thread_pool.h"
+
+namespace osal {
+
+// 串行执行器(strand): 投递到同一个strand的任务按投递顺序逐个执行, 任意时刻最多一个工作线程在执行它的任务,
+// 任务之间不需要加锁; 大量strand共享一个线程池, 不需要为每个组件创建线程
+// 每个strand一个无锁多生产者单消费者队列, 投递只做一次原子交换和一次计数; 计数从0变为1的投递者负责把
+// 排空任务提交到线程池, 排空任务每次最多执行batch个任务后重新排队, 避免一个繁忙的strand长期占用工作线程
+// 线程池队列已满拒绝提交时在当前线程排空; 线程池不能使用DropOldest策略, 被丢弃的排空任务会使strand停止执行
+class OSALStrand {
+public:
+    explicit OSALStrand(OSALThreadPool &pool, int priority = 0, uint32_t batch = 16)
+        : state_(std::make_shared<State>(pool, priority, batch > 0 ? batch : 1)) {}
+
+    OSALStrand(const OSALStrand &) = delete;
+
+    OSALStrand &operator=(const OSALStrand &) = delete;
+
+    // 投递任务, function为无参或以void*为参数(传入nullptr)的可调用对象; strand销毁后已投递的任务仍会执行
+    template <typename F, typename = std::enable_if_t<OSALTaskFunction<>::isCallable<std::decay_t<F>>>>
+    void post(F &&function) {
+        Node *node = new Node(std::forward<F>(function));
+        state_->push(node);
+        if (state_->pending.fetch_add(1, std::memory_order_acq_rel) == 0) {
+            schedule(state_);
+        }
+    }
+
+    // 当前线程正在执行本strand的任务时直接执行, 否则投递
+    template <typename F, typename = std::enable_if_t<OSALTaskFunction<>::isCallable<std::decay_t<F>>>>
+    void dispatch(F &&function) {
+        if (runningInThisThread()) {
+            if constexpr (std::is_invocable_v<F &, void *>) {
+                function(nullptr);
+            } else {
+                function();
+            }
+            return;
+        }
+        post(std::forward<F>(function));
+    }
+
+    // 投递任意可调用对象并返回future, 结果通过function()的返回值获得
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F> &>>
+    OSALFuture<R> submit(F &&function) {
+        OSALPromise<R> promise;
+        OSALFuture<R> future = promise.getFuture();
+        post([promise = std::move(promise), function = std::forward<F>(function)]() mutable {
+            promise.setValueFrom(function);
+        });
+        return future;
+    }
+
+    // 当前线程是否正在执行本strand的任务
+    [[nodiscard]] bool runningInThisThread() const { return current() == state_.get(); }
+
+    // 已投递但尚未执行完的任务数
+    [[nodiscard]] size_t pending() const { return state_->pending.load(std::memory_order_acquire); }
+
+private:
+    struct Node {
+        template <typename F>
+        explicit Node(F &&f) : function(std::forward<F>(f)) {}
+
+        std::atomic<Node *> next{nullptr};
+        OSALTaskFunction<> function;
+    };
+
+    // 侵入式MPSC队列(Vyukov): 生产者交换head_后链接next, 消费者从tail_取出; stub_保证队列永不为空
+    struct State {
+        State(OSALThreadPool &p, int prio, uint32_t n) : pool(p), priority(prio), batch(n), head(&stub), tail(&stub) {}
+
+        ~State() {
+            // 线程池停止后未排空的任务随strand一起释放
+            while (Node *node = pop()) {
+                delete node;
+            }
+        }
+
+        void push(Node *node) {
+            node->next.store(nullptr, std::memory_order_relaxed);
+            Node *previous = head.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        // 只由持有排空权的线程调用; 生产者已交换head_但尚未链接next时返回nullptr
+        Node *pop() {
+            Node *first = tail;
+            Node *next = first->next.load(std::memory_order_acquire);
+            if (first == &stub) {
+                if (next == nullptr) return nullptr;
+                tail = next;
+                first = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+            if (next != nullptr) {
+                tail = next;
+                return first;
+            }
+            if (first != head.load(std::memory_order_acquire)) return nullptr;
+            push(&stub);
+            next = first->next.load(std::memory_order_acquire);
+            if (next != nullptr) {
+                tail = next;
+                return first;
+            }
+            return nullptr;
+        }
+
+        OSALThreadPool &pool;
+        int priority;
+        uint32_t batch;
+        std::atomic<size_t> pending{0};  // 已投递未执行完的任务数, 从0变为1的投递者负责调度排空
+        std::atomic<Node *> head;
+        Node *tail;
+        Node stub{nullptr};
+    };
+
+    static const State *&current() {
+        static thread_local const State *state = nullptr;
+        return state;
+    }
+
+    // 提交排空任务; 被拒绝时在当前线程排空, 直到strand为空或重新提交成功
+    static void schedule(const std::shared_ptr<State> &state) {
+        while (true) {
+            ThreadPoolSubmitStatus status = state->pool.post(
+                [state]() {
+                    if (drain(*state)) schedule(state);
+                },
+                state->priority);
+            if (status == ThreadPoolSubmitStatus::Accepted || status == ThreadPoolSubmitStatus::RanInCaller) return;
+            if (!drain(*state)) return;
+        }
+    }
+
+    // 最多执行batch个任务, strand仍有任务时返回true
+    static bool drain(State &state) {
+        const State *previous = current();
+        current() = &state;
+        bool more = true;
+        for (uint32_t i = 0; i < state.batch; ++i) {
+            Node *node = state.pop();
+            while (node == nullptr) {
+                // 计数表明有任务, 生产者正在链接节点
+                cpuRelax();
+                node = state.pop();
+            }
+            node->function(nullptr);
+            delete node;
+            if (state.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                more = false;
+                break;
+            }
+        }
+        current() = previous;
+        return more;
+    }
+
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_STRAND_H__
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_TASK_FUNCTION_H__
+#define __OSAL_TASK_FUNCTION_H__
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "osal.h"
+
+#ifndef OSAL_CONFIG_TASK_INLINE_SIZE
+#define OSAL_CONFIG_TASK_INLINE_SIZE 56  // 任务闭包的内联存储大小(字节), 加上虚表指针正好占一个缓存行
+#endif
+
+namespace osal {
+
+namespace detail {
+
+template <typename F>
+struct OSALIsStdFunction : std::false_type {};
+
+template <typename Signature>
+struct OSALIsStdFunction<std::function<Signature>> : std::true_type {};
+
+}  // namespace detail
+
+// 只可移动的任务函数, 签名为void(void *), 也接受无参数的可调用对象
+// 闭包不超过InlineSize且可无异常移动时直接存放在对象内部, 不产生堆分配; 否则退化为堆上存储
+template <size_t InlineSize = OSAL_CONFIG_TASK_INLINE_SIZE>
+class OSALTaskFunction {
+public:
+    // 判断可调用对象能否内联存储
+    template <typename F>
+    static constexpr bool isInline = sizeof(F) <= InlineSize && alignof(F) <= alignof(std::max_align_t) &&
+                                     std::is_nothrow_move_constructible_v<F>;
+
+    // 判断可调用对象能否作为任务: 接受void *参数或无参数
+    template <typename F>
+    static constexpr bool isCallable = std::is_invocable_v<F &, void *> || std::is_invocable_v<F &>;
+
+    // 判断可调用对象是否可能为空: 函数指针、成员指针和std::function
+    template <typename F>
+    static constexpr bool isNullable =
+        std::is_pointer_v<F> || std::is_member_pointer_v<F> || detail::OSALIsStdFunction<F>::value;
+
+    OSALTaskFunction() noexcept = default;
+
+    OSALTaskFunction(std::nullptr_t) noexcept {}
+
+    template <typename F, typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<Fn, OSALTaskFunction> && isCallable<Fn>>>
+    OSALTaskFunction(F &&function) {
+        // 空的函数指针或std::function构造出空任务; 由函数名退化得到的指针不可能为空, 不做比较
+        if constexpr (isNullable<Fn> && std::is_same_v<std::remove_cvref_t<F>, Fn>) {
+            if (function == nullptr) return;
+        }
+        vtable_ = &kVTable<Fn, isInline<Fn>>;
+        if constexpr (isInline<Fn>) {
+            ::new (static_cast<void *>(storage_)) Fn(std::forward<F>(function));
+        } else {
+            *reinterpret_cast<Fn **>(storage_) = new Fn(std::forward<F>(function));
+        }
+    }
+
+    OSALTaskFunction(OSALTaskFunction &&other) noexcept : vtable_(other.vtable_) {
+        if (vtable_ != nullptr) {
+            vtable_->relocate(storage_, other.storage_);
+            other.vtable_ = nullptr;
+        }
+    }
+
+    OSALTaskFunction &operator=(OSALTaskFunction &&other) noexcept {
+        if (this != &other) {
+            reset();
+            vtable_ = other.vtable_;
+            if (vtable_ != nullptr) {
+                vtable_->relocate(storage_, other.storage_);
+                other.vtable_ = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    OSALTaskFunction &operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    OSALTaskFunction(const OSALTaskFunction &) = delete;
+
+    OSALTaskFunction &operator=(const OSALTaskFunction &) = delete;
+
+    ~OSALTaskFunction() { reset(); }
+
+    void operator()(void *argument = nullptr) { vtable_->invoke(storage_, argument); }
+
+    explicit operator bool() const noexcept { return vtable_ != nullptr; }
+
+    bool operator==(std::nullptr_t) const noexcept { return vtable_ == nullptr; }
+
+    // 获取指向所存储可调用对象的指针, 类型不匹配时返回nullptr
+    template <typename F>
+    F *target() noexcept {
+        if (vtable_ != &kVTable<F, isInline<F>>) return nullptr;
+        return static_cast<F *>(callable<F, isInline<F>>(storage_));
+    }
+
+    template <typename F>
+    const F *target() const noexcept {
+        return const_cast<OSALTaskFunction *>(this)->template target<F>();
+    }
+
+    void reset() noexcept {
+        if (vtable_ != nullptr) {
+            vtable_->destroy(storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+private:
+    struct VTable {
+        void (*invoke)(void *storage, void *argument);
+        void (*relocate)(void *dst, void *src) noexcept;  // 移动到dst并销毁src
+        void (*destroy)(void *storage) noexcept;
+    };
+
+    template <typename Fn, bool Inline>
+    static void *callable(void *storage) noexcept {
+        if constexpr (Inline) {
+            return storage;
+        } else {
+            return *static_cast<Fn **>(storage);
+        }
+    }
+
+    template <typename Fn, bool Inline>
+    static void invokeImpl(void *storage, void *argument) {
+        Fn &function = *static_cast<Fn *>(callable<Fn, Inline>(storage));
+        if constexpr (std::is_invocable_v<Fn &, void *>) {
+            std::invoke(function, argument);
+        } else {
+            (void)argument;
+            std::invoke(function);
+        }
+    }
+
+    template <typename Fn, bool Inline>
+    static void relocateImpl(void *dst, void *src) noexcept {
+        if constexpr (Inline) {
+            Fn *source = static_cast<Fn *>(src);
+            ::new (dst) Fn(std::move(*source));
+            source->~Fn();
+        } else {
+            *static_cast<Fn **>(dst) = *static_cast<Fn **>(src);
+        }
+    }
+
+    template <typename Fn, bool Inline>
+    static void destroyImpl(void *storage) noexcept {
+        if constexpr (Inline) {
+            static_cast<Fn *>(storage)->~Fn();
+        } else {
+            delete *static_cast<Fn **>(storage);
+        }
+    }
+
+    template <typename Fn, bool Inline>
+    static constexpr VTable kVTable = {&invokeImpl<Fn, Inline>, &relocateImpl<Fn, Inline>, &destroyImpl<Fn, Inline>};
+
+    alignas(std::max_align_t) unsigned char storage_[InlineSize];
+    const VTable *vtable_ = nullptr;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_TASK_FUNCTION_H__
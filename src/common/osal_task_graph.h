@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_TASK_GRAPH_H__
+#define __OSAL_TASK_GRAPH_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "osal_debug.h"
+#include "osal_future.h"
+#include "osal_task_function.h"
+#include "osal_thread_pool.h"
+
+namespace osal {
+
+// 任务图(DAG): 节点和依赖边只构建一次, 之后可在线程池上反复运行
+// 每个节点维护未完成前驱的原子计数, 节点完成时直接调度计数归零的后继: 第一个后继在当前线程上接着执行,
+// 省去一次入队和唤醒, 其余后继提交到线程池; 同一时间只能有一次运行, 运行期间不能修改图
+// 线程池队列已满拒绝提交时节点改在当前线程执行; 线程池不能使用DropOldest策略, 被丢弃的节点会使运行无法结束
+class OSALTaskGraph {
+public:
+    using NodeId = size_t;
+
+    OSALTaskGraph() = default;
+
+    OSALTaskGraph(const OSALTaskGraph &) = delete;
+
+    OSALTaskGraph &operator=(const OSALTaskGraph &) = delete;
+
+    // 添加节点, function为无参或以void*为参数(传入nullptr)的可调用对象, priority为提交到线程池时的优先级
+    template <typename F, typename = std::enable_if_t<OSALTaskFunction<>::isCallable<std::decay_t<F>>>>
+    NodeId addNode(F &&function, int priority = 0) {
+        auto node = std::make_unique<Node>();
+        node->function = OSALTaskFunction<>(std::forward<F>(function));
+        node->priority = priority;
+        node->index = nodes_.size();
+        nodes_.push_back(std::move(node));
+        validated_ = false;
+        return nodes_.size() - 1;
+    }
+
+    // 添加依赖边: before完成后after才能开始
+    void precede(NodeId before, NodeId after) {
+        nodes_[before]->successors.push_back(nodes_[after].get());
+        ++nodes_[after]->predecessors;
+        validated_ = false;
+    }
+
+    [[nodiscard]] size_t size() const { return nodes_.size(); }
+
+    // 检查图中是否有环, 有环的图无法运行
+    [[nodiscard]] bool isAcyclic() {
+        if (!validated_) {
+            acyclic_ = checkAcyclic();
+            validated_ = true;
+        }
+        return acyclic_;
+    }
+
+    // 异步运行一次, 返回的future在所有节点执行完毕后就绪; 图有环时future直接就绪且没有值
+    OSALFuture<void> runAsync(OSALThreadPool &pool) {
+        OSALPromise<void> promise;
+        OSALFuture<void> future = promise.getFuture();
+        if (!isAcyclic()) {
+            OSAL_LOGE("Task graph has a cycle\n");
+            return future;
+        }
+        if (nodes_.empty()) {
+            promise.setValue();
+            return future;
+        }
+        pool_ = &pool;
+        promise_.emplace(std::move(promise));
+        remaining_.store(nodes_.size(), std::memory_order_relaxed);
+        std::vector<OSALThreadPool::Task> roots;
+        for (auto &node : nodes_) {
+            node->pending.store(node->predecessors, std::memory_order_relaxed);
+            if (node->predecessors == 0) {
+                roots.push_back(OSALThreadPool::Task{[this, ptr = node.get()]() { execute(ptr); }, nullptr,
+                                                     node->priority});
+            }
+        }
+        // submitBatch内部的加锁保证上面的计数对执行节点的工作线程可见; 队列已满被拒绝时在当前线程执行
+        if (!accepted(pool.submitBatch(std::span<OSALThreadPool::Task>(roots)))) {
+            for (auto &root : roots) {
+                root.function(nullptr);
+            }
+        }
+        return future;
+    }
+
+    // 运行一次并等待所有节点完成, 图有环时返回false
+    bool run(OSALThreadPool &pool) {
+        if (!isAcyclic()) {
+            OSAL_LOGE("Task graph has a cycle\n");
+            return false;
+        }
+        runAsync(pool).wait();
+        return true;
+    }
+
+private:
+    struct Node {
+        OSALTaskFunction<> function;
+        std::vector<Node *> successors;
+        uint32_t predecessors = 0;
+        std::atomic<uint32_t> pending{0};
+        int priority = 0;
+        size_t index = 0;
+    };
+
+    // RanInCaller表示节点已在提交线程中执行
+    static bool accepted(ThreadPoolSubmitStatus status) {
+        return status == ThreadPoolSubmitStatus::Accepted || status == ThreadPoolSubmitStatus::RanInCaller;
+    }
+
+    void execute(Node *node) {
+        while (node != nullptr) {
+            node->function(nullptr);
+            Node *next = nullptr;
+            for (Node *successor : node->successors) {
+                if (successor->pending.fetch_sub(1, std::memory_order_acq_rel) != 1) continue;
+                if (next == nullptr) {
+                    next = successor;
+                } else if (!accepted(pool_->post([this, successor]() { execute(successor); }, successor->priority))) {
+                    execute(successor);
+                }
+            }
+            // 最后一个完成的节点结束本次运行; 此后本线程不再访问图, 等待方可以立即重新运行或销毁图
+            if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                OSALPromise<void> promise = std::move(*promise_);
+                promise.setValue();
+                return;
+            }
+            node = next;
+        }
+    }
+
+    // Kahn算法: 能按拓扑序取完所有节点即无环
+    bool checkAcyclic() const {
+        std::vector<uint32_t> indegree(nodes_.size());
+        std::vector<const Node *> ready;
+        for (size_t i = 0; i < nodes_.size(); ++i) {
+            indegree[i] = nodes_[i]->predecessors;
+            if (indegree[i] == 0) ready.push_back(nodes_[i].get());
+        }
+        size_t visited = 0;
+        while (!ready.empty()) {
+            const Node *node = ready.back();
+            ready.pop_back();
+            ++visited;
+            for (const Node *successor : node->successors) {
+                if (--indegree[successor->index] == 0) ready.push_back(successor);
+            }
+        }
+        return visited == nodes_.size();
+    }
+
+    std::vector<std::unique_ptr<Node>> nodes_;
+    OSALThreadPool *pool_ = nullptr;
+    std::optional<OSALPromise<void>> promise_;  // 当前运行的完成通知, 由最后完成的节点取走
+    std::atomic<size_t> remaining_{0};
+    bool validated_ = true;
+    bool acyclic_ = true;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_TASK_GRAPH_H__
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_TASK_GROUP_H__
+#define __OSAL_TASK_GROUP_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "osal_semaphore.h"
+#include "osal_task_function.h"
+#include "osal_thread_pool.h"
+
+namespace osal {
+
+// 分叉-合并任务组: run()把子任务提交到线程池, wait()等待本组全部子任务完成
+// 等待期间调用线程帮忙执行线程池中排队的任务, 工作线程在任务中等待子任务时不会因线程全部阻塞而死锁;
+// 没有可帮忙的任务时阻塞, 本组run()提交新的子任务或全部子任务完成时才被唤醒, 不轮询;
+// 子任务可以继续向同一组run(); 同一时间只能有一个线程wait(), wait()返回后任务组可以再次使用
+// 线程池队列已满拒绝提交时子任务在当前线程执行; 线程池不能使用DropOldest策略, 被丢弃的子任务会使wait()无法返回
+class OSALTaskGroup {
+public:
+    // 一轮等待中最多积累完成信号和一次run()唤醒两个信号, cmsis_os后端init()后信号量上限为16
+    explicit OSALTaskGroup(OSALThreadPool &pool, int priority = 0)
+        : pool_(pool), priority_(priority), pending_(1), submitted_(0), waiting_(false) {
+        done_.init(0);
+    }
+
+    // 析构前等待尚未完成的子任务
+    ~OSALTaskGroup() { wait(); }
+
+    OSALTaskGroup(const OSALTaskGroup &) = delete;
+
+    OSALTaskGroup &operator=(const OSALTaskGroup &) = delete;
+
+    // 提交子任务, function为无参或以void*为参数(传入nullptr)的可调用对象
+    template <typename F, typename = std::enable_if_t<OSALTaskFunction<>::isCallable<std::decay_t<F>>>>
+    void run(F &&function) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        OSALThreadPool::Task task{OSALTaskFunction<>(
+                                      [this, function = std::forward<F>(function)]() mutable {
+                                          if constexpr (std::is_invocable_v<std::decay_t<F> &, void *>) {
+                                              function(nullptr);
+                                          } else {
+                                              function();
+                                          }
+                                          finish();
+                                      }),
+                                  nullptr, priority_};
+        ThreadPoolSubmitStatus status = pool_.submitBatch(std::span<OSALThreadPool::Task>(&task, 1));
+        if (status == ThreadPoolSubmitStatus::Rejected || status == ThreadPoolSubmitStatus::Timeout) {
+            task.function(nullptr);
+        } else if (status == ThreadPoolSubmitStatus::Accepted) {
+            // 新任务已入队, 唤醒阻塞中的等待者来帮忙执行
+            submitted_.fetch_add(1, std::memory_order_seq_cst);
+            if (waiting_.load(std::memory_order_seq_cst) && waiting_.exchange(false, std::memory_order_acq_rel)) {
+                done_.signal();
+            }
+        }
+    }
+
+    // 等待全部子任务完成; 没有可帮忙的排队任务时登记后阻塞在信号量上
+    void wait() {
+        // pending_中的1是等待者自己的计数, 最后一个完成的子任务释放一次信号量
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            size_t signals = 1;  // 本轮需取走的信号数: 完成信号一个, 登记每被run()认领一次再加一个
+            while (pending_.load(std::memory_order_acquire) != 0) {
+                uint32_t epoch = submitted_.load(std::memory_order_seq_cst);
+                if (pool_.runPendingTask()) continue;
+                // 登记后重新检查, 检查之前发生的提交或完成不会被错过, 之后的由run()或finish()唤醒
+                waiting_.store(true, std::memory_order_seq_cst);
+                if (pending_.load(std::memory_order_seq_cst) != 0 &&
+                    submitted_.load(std::memory_order_seq_cst) == epoch) {
+                    done_.wait();
+                    --signals;
+                }
+                if (!waiting_.exchange(false, std::memory_order_acq_rel)) {
+                    ++signals;
+                }
+            }
+            // 取走剩余的信号, 同时保证完成子任务的线程已不再访问本任务组
+            for (; signals > 0; --signals) {
+                done_.wait();
+            }
+        }
+        pending_.store(1, std::memory_order_relaxed);
+    }
+
+    // 尚未完成的子任务数
+    [[nodiscard]] size_t pending() const {
+        size_t count = pending_.load(std::memory_order_acquire);
+        return count > 0 ? count - 1 : 0;
+    }
+
+private:
+    void finish() {
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            done_.signal();
+        }
+    }
+
+    OSALThreadPool &pool_;
+    int priority_;
+    std::atomic<size_t> pending_;     // 未完成的子任务数加上等待者的1
+    std::atomic<uint32_t> submitted_;  // run()成功入队的次数, 等待者据此判断登记前是否有新任务
+    std::atomic<bool> waiting_;        // 等待者已登记将要阻塞, run()认领后释放一次信号量
+    OSALSemaphore done_;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_TASK_GROUP_H__
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_TASK_HANDLE_H__
+#define __OSAL_TASK_HANDLE_H__
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace osal {
+
+namespace detail {
+
+// 可取消任务的共享控制块, 由任务闭包、句柄和取消令牌共同持有(引用计数)
+class OSALTaskControl {
+public:
+    enum : uint32_t { kPending, kRunning, kDone, kCancelled };
+
+    void retain() { refs_.fetch_add(1, std::memory_order_relaxed); }
+
+    void release() {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    // 尚未开始的任务直接标记为已取消, 工作线程出队时跳过; 正在执行的任务只设置取消请求, 由任务自行检查
+    bool cancel() {
+        stopRequested_.store(true, std::memory_order_release);
+        uint32_t expected = kPending;
+        return state_.compare_exchange_strong(expected, kCancelled, std::memory_order_acq_rel);
+    }
+
+    bool tryStart() {
+        uint32_t expected = kPending;
+        return state_.compare_exchange_strong(expected, kRunning, std::memory_order_acq_rel);
+    }
+
+    void finish() { state_.store(kDone, std::memory_order_release); }
+
+    // 周期任务执行完一次后回到Pending等待下一次触发; 已被请求取消时结束为Cancelled并返回false
+    bool rearm() {
+        if (!stopRequested()) {
+            state_.store(kPending, std::memory_order_release);
+            if (!stopRequested()) return true;
+        }
+        state_.store(kCancelled, std::memory_order_release);
+        return false;
+    }
+
+    [[nodiscard]] uint32_t state() const { return state_.load(std::memory_order_acquire); }
+
+    [[nodiscard]] bool stopRequested() const { return stopRequested_.load(std::memory_order_acquire); }
+
+private:
+    std::atomic<uint32_t> state_{kPending};
+    std::atomic<bool> stopRequested_{false};
+    std::atomic<uint32_t> refs_{1};
+};
+
+// 控制块的侵入式引用计数指针
+class OSALTaskControlRef {
+public:
+    OSALTaskControlRef() = default;
+
+    explicit OSALTaskControlRef(OSALTaskControl *control) : control_(control) {}
+
+    OSALTaskControlRef(const OSALTaskControlRef &other) : control_(other.control_) {
+        if (control_ != nullptr) control_->retain();
+    }
+
+    OSALTaskControlRef(OSALTaskControlRef &&other) noexcept : control_(std::exchange(other.control_, nullptr)) {}
+
+    OSALTaskControlRef &operator=(OSALTaskControlRef other) noexcept {
+        std::swap(control_, other.control_);
+        return *this;
+    }
+
+    ~OSALTaskControlRef() {
+        if (control_ != nullptr) control_->release();
+    }
+
+    static OSALTaskControlRef create() { return OSALTaskControlRef(new OSALTaskControl()); }
+
+    OSALTaskControl *get() const { return control_; }
+
+    OSALTaskControl *operator->() const { return control_; }
+
+private:
+    OSALTaskControl *control_ = nullptr;
+};
+
+}  // namespace detail
+
+// 协作式取消令牌: 正在执行的任务定期检查, 发现取消请求后自行提前返回
+class OSALCancellationToken {
+public:
+    OSALCancellationToken() = default;
+
+    explicit OSALCancellationToken(detail::OSALTaskControlRef control) : control_(std::move(control)) {}
+
+    [[nodiscard]] bool isCancellationRequested() const {
+        return control_.get() != nullptr && control_->stopRequested();
+    }
+
+private:
+    detail::OSALTaskControlRef control_;
+};
+
+// 可取消任务的句柄, 可复制, 所有副本指向同一个任务
+class OSALTaskHandle {
+public:
+    enum class Status { Invalid, Pending, Running, Done, Cancelled };
+
+    OSALTaskHandle() = default;
+
+    explicit OSALTaskHandle(detail::OSALTaskControlRef control) : control_(std::move(control)) {}
+
+    [[nodiscard]] bool valid() const { return control_.get() != nullptr; }
+
+    // O(1)取消: 任务尚未开始时返回true, 该任务不会再执行; 已开始或已结束时返回false,
+    // 正在执行的任务可通过OSALCancellationToken观察到取消请求; 周期任务被取消后不再触发
+    bool cancel() { return valid() && control_->cancel(); }
+
+    [[nodiscard]] Status status() const {
+        if (!valid()) return Status::Invalid;
+        switch (control_->state()) {
+            case detail::OSALTaskControl::kPending:
+                return Status::Pending;
+            case detail::OSALTaskControl::kRunning:
+                return Status::Running;
+            case detail::OSALTaskControl::kDone:
+                return Status::Done;
+            default:
+                return Status::Cancelled;
+        }
+    }
+
+    [[nodiscard]] bool isCancelled() const { return status() == Status::Cancelled; }
+
+    [[nodiscard]] bool isDone() const { return status() == Status::Done; }
+
+    // 任务可以是无参的可调用对象, 也可以接受一个OSALCancellationToken
+    template <typename F>
+    static constexpr bool isTaskCallable = std::is_invocable_v<F &> || std::is_invocable_v<F &, OSALCancellationToken>;
+
+    // 由线程池在工作线程上调用: 出队时已被取消的任务直接跳过
+    template <typename F>
+    static void run(const detail::OSALTaskControlRef &control, F &function) {
+        if (!control->tryStart()) return;
+        if constexpr (std::is_invocable_v<F &, OSALCancellationToken>) {
+            function(OSALCancellationToken(control));
+        } else {
+            function();
+        }
+        control->finish();
+    }
+
+    // 周期任务的一次触发, 返回false表示任务已被取消, 不再安排下一次触发
+    template <typename F>
+    static bool runPeriodic(const detail::OSALTaskControlRef &control, F &function) {
+        if (control->stopRequested()) {
+            control->cancel();
+            return false;
+        }
+        if (!control->tryStart()) return false;
+        if constexpr (std::is_invocable_v<F &, OSALCancellationToken>) {
+            function(OSALCancellationToken(control));
+        } else {
+            function();
+        }
+        return control->rearm();
+    }
+
+private:
+    detail::OSALTaskControlRef control_;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_TASK_HANDLE_H__
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_THREAD_POOL_GROUP_H__
+#define __OSAL_THREAD_POOL_GROUP_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "osal_cpu_set.h"
+#include "osal_thread_pool.h"
+
+namespace osal {
+
+// 按CPU拆分的线程池组: cpuSet中的每个CPU一个子线程池, 子池的线程绑定在该CPU上
+// 任务按key分发, 相同key的任务总在同一个CPU上执行, 数据留在该核的缓存中, 子池之间不共享队列
+class OSALThreadPoolGroup {
+public:
+    OSALThreadPoolGroup() = default;
+
+    ~OSALThreadPoolGroup() { stop(); }
+
+    OSALThreadPoolGroup(const OSALThreadPoolGroup &) = delete;
+
+    OSALThreadPoolGroup &operator=(const OSALThreadPoolGroup &) = delete;
+
+    // cpuSet为0时按单个不绑定CPU的子池启动; 任一子池启动失败时返回-1, 该子池保留在组中但不执行任务
+    int start(OSALCpuSet cpuSet, uint32_t threadsPerCpu = 1, int priority = 0, int stack_size = 0) {
+        stop();
+        int result = 0;
+        uint32_t count = cpuSet != 0 ? cpuSetCount(cpuSet) : 1;
+        for (uint32_t i = 0; i < count; ++i) {
+            auto pool = std::make_unique<OSALThreadPool>();
+            pool->setAffinity(cpuSet != 0 ? cpuSetOf(cpuSetNth(cpuSet, i)) : 0, false);
+            if (pool->start(threadsPerCpu, priority, stack_size) != 0) {
+                result = -1;
+            }
+            pools_.push_back(std::move(pool));
+        }
+        return result;
+    }
+
+    void stop() {
+        for (auto &pool : pools_) {
+            pool->stop();
+        }
+        pools_.clear();
+    }
+
+    [[nodiscard]] size_t size() const { return pools_.size(); }
+
+    // 第index个子池, 对应cpuSet中第index个CPU
+    OSALThreadPool &pool(size_t index) { return *pools_[index]; }
+
+    // 第index个子池的CPU集合
+    [[nodiscard]] OSALCpuSet affinity(size_t index) const { return pools_[index]->getAffinity(); }
+
+    // 按key选择子池
+    OSALThreadPool &poolFor(size_t key) { return *pools_[key % pools_.size()]; }
+
+    template <typename F>
+    ThreadPoolSubmitStatus post(size_t key, F &&function, int priority = 0) {
+        return poolFor(key).post(std::forward<F>(function), priority);
+    }
+
+    template <typename F, typename... Args>
+    auto submit(size_t key, F &&function, Args &&...args) {
+        return poolFor(key).submit(std::forward<F>(function), std::forward<Args>(args)...);
+    }
+
+private:
+    std::vector<std::unique_ptr<OSALThreadPool>> pools_;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_THREAD_POOL_GROUP_H__
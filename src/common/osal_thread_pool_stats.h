@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __OSAL_THREAD_POOL_STATS_H__
+#define __OSAL_THREAD_POOL_STATS_H__
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "osal_lockguard.h"
+#include "osal_mutex.h"
+
+#ifndef OSAL_CONFIG_THREAD_POOL_STATS
+#define OSAL_CONFIG_THREAD_POOL_STATS 1  // 线程池任务耗时统计, 0表示关闭(提交和执行时不再读取时钟)
+#endif
+
+namespace osal {
+
+// 耗时直方图(us), 按2的幂分桶: 第0桶为0us, 第i桶为[2^(i-1), 2^i)us, 最后一桶包含所有更大的值
+struct OSALLatencyHistogram {
+    static constexpr size_t kBuckets = 32;
+
+    uint64_t buckets[kBuckets]{};
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+
+    static constexpr size_t bucketOf(uint64_t us) {
+        return std::min<size_t>(static_cast<size_t>(std::bit_width(us)), kBuckets - 1);
+    }
+
+    // 第index桶包含的最大值
+    static constexpr uint64_t upperBound(size_t index) { return index == 0 ? 0 : (uint64_t{1} << index) - 1; }
+
+    void record(uint64_t us) {
+        ++buckets[bucketOf(us)];
+        ++count;
+        sum += us;
+        max = std::max(max, us);
+    }
+
+    void merge(const OSALLatencyHistogram &other) {
+        for (size_t i = 0; i < kBuckets; ++i) {
+            buckets[i] += other.buckets[i];
+        }
+        count += other.count;
+        sum += other.sum;
+        max = std::max(max, other.max);
+    }
+
+    [[nodiscard]] double mean() const { return count > 0 ? static_cast<double>(sum) / count : 0.0; }
+
+    // p分位数(0~1), 返回所在桶的上界, 精度为2倍以内, 不超过记录到的最大值
+    [[nodiscard]] uint64_t percentile(double p) const {
+        if (count == 0) return 0;
+        auto rank = static_cast<uint64_t>(p * static_cast<double>(count));
+        rank = std::clamp<uint64_t>(rank, 1, count);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets; ++i) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return std::min(upperBound(i), max);
+            }
+        }
+        return max;
+    }
+};
+
+// 单个工作线程的统计
+struct ThreadPoolWorkerStats {
+    uint64_t tasksCompleted;  // 该线程执行完成的任务数
+    uint64_t busyUs;          // 执行任务的时间
+    double busyRatio;         // 执行任务的时间占该线程存活时间的比例
+};
+
+// 线程池统计快照, 均从启动或上次resetStats()开始计算
+struct ThreadPoolStats {
+    uint64_t elapsedUs;         // 统计时长
+    uint64_t tasksSubmitted;    // 提交的任务数
+    uint64_t tasksCompleted;    // 执行完成的任务数
+    uint64_t tasksRejected;     // 队列已满时被拒绝或等待空位超时的任务数
+    uint64_t tasksDropped;      // 队列已满时被丢弃的排队任务数
+    uint64_t tasksRanInCaller;  // 队列已满时在提交线程中执行的任务数
+    double throughput;          // 每秒完成的任务数
+    double busyRatio;           // 当前工作线程的整体忙碌比例, 偏低说明任务太少, 接近1且排队等待长说明线程不足
+
+    OSALLatencyHistogram queueWait;  // 从提交到开始执行
+    OSALLatencyHistogram execution;  // 执行时间
+    OSALLatencyHistogram endToEnd;   // 从提交到执行完成
+
+    std::vector<ThreadPoolWorkerStats> workers;  // 当前每个工作线程的统计
+};
+
+namespace detail {
+
+// 单写入者直方图: 只由所属工作线程写入, 用relaxed的读-改-写代替原子加, 执行任务时不产生总线锁;
+// 其他线程读取快照时各字段之间不保证一致
+class OSALShardHistogram {
+public:
+    void record(uint64_t us) {
+        add(buckets_[OSALLatencyHistogram::bucketOf(us)], 1);
+        add(sum_, us);
+        if (us > max_.load(std::memory_order_relaxed)) {
+            max_.store(us, std::memory_order_relaxed);
+        }
+    }
+
+    void mergeInto(OSALLatencyHistogram &histogram) const {
+        for (size_t i = 0; i < OSALLatencyHistogram::kBuckets; ++i) {
+            uint64_t count = buckets_[i].load(std::memory_order_relaxed);
+            histogram.buckets[i] += count;
+            histogram.count += count;
+        }
+        histogram.sum += sum_.load(std::memory_order_relaxed);
+        histogram.max = std::max(histogram.max, max_.load(std::memory_order_relaxed));
+    }
+
+    void clear() {
+        for (auto &bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        sum_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    static void add(std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> buckets_[OSALLatencyHistogram::kBuckets]{};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+}  // namespace detail
+
+// 线程池统计: 每个工作线程独占一个按缓存行对齐的分片, 执行任务时只写自己的分片, 读取快照时再合并
+// 线程退出后分片保留并由新线程复用, 其累计数据仍计入整体统计
+// 重置只递增代数, 分片由所属线程在下一次记录时自行清零, 快照跳过代数过期的分片
+class OSALThreadPoolStatsRegistry {
+public:
+    struct alignas(64) Shard {
+        detail::OSALShardHistogram queueWait;
+        detail::OSALShardHistogram execution;
+        detail::OSALShardHistogram endToEnd;
+        std::atomic<uint64_t> workerCompleted{0};  // 以下三项只统计当前占用分片的线程
+        std::atomic<uint64_t> workerBusyUs{0};
+        std::atomic<uint64_t> workerSinceUs{0};
+        std::atomic<uint32_t> generation{0};
+        std::atomic<bool> inUse{false};
+
+        void clear(uint32_t currentGeneration) {
+            queueWait.clear();
+            execution.clear();
+            endToEnd.clear();
+            workerCompleted.store(0, std::memory_order_relaxed);
+            workerBusyUs.store(0, std::memory_order_relaxed);
+            generation.store(currentGeneration, std::memory_order_relaxed);
+        }
+    };
+
+    // 工作线程进入任务循环时获取分片, 优先复用已退出线程的分片
+    Shard *acquire(uint64_t now) {
+        OSALLockGuard lockGuard(mutex_);
+        Shard *shard = nullptr;
+        for (auto &candidate : shards_) {
+            if (!candidate->inUse.load(std::memory_order_acquire)) {
+                shard = candidate.get();
+                break;
+            }
+        }
+        if (shard == nullptr) {
+            shards_.push_back(std::make_unique<Shard>());
+            shard = shards_.back().get();
+            shard->generation.store(generation_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        uint32_t currentGeneration = generation_.load(std::memory_order_relaxed);
+        if (shard->generation.load(std::memory_order_relaxed) != currentGeneration) {
+            shard->clear(currentGeneration);
+        }
+        shard->workerCompleted.store(0, std::memory_order_relaxed);
+        shard->workerBusyUs.store(0, std::memory_order_relaxed);
+        shard->workerSinceUs.store(now, std::memory_order_relaxed);
+        shard->inUse.store(true, std::memory_order_relaxed);
+        return shard;
+    }
+
+    // 只做一次原子写, 线程退出路径上不加锁
+    void release(Shard *shard) { shard->inUse.store(false, std::memory_order_release); }
+
+    void recordSubmit(size_t count) {
+#if OSAL_CONFIG_THREAD_POOL_STATS
+        submitted_.fetch_add(count, std::memory_order_relaxed);
+#endif
+    }
+
+    // 队列满时的溢出处理, 不计入tasksSubmitted
+    void recordRejected(size_t count) {
+#if OSAL_CONFIG_THREAD_POOL_STATS
+        rejected_.fetch_add(count, std::memory_order_relaxed);
+#endif
+    }
+
+    void recordDropped(size_t count) {
+#if OSAL_CONFIG_THREAD_POOL_STATS
+        dropped_.fetch_add(count, std::memory_order_relaxed);
+#endif
+    }
+
+    void recordRanInCaller(size_t count) {
+#if OSAL_CONFIG_THREAD_POOL_STATS
+        ranInCaller_.fetch_add(count, std::memory_order_relaxed);
+#endif
+    }
+
+    // 只能由占用shard的工作线程调用; submitted、started、finished为同一时钟的时间戳(us)
+    void recordTask(Shard *shard, uint64_t submitted, uint64_t started, uint64_t finished) {
+#if OSAL_CONFIG_THREAD_POOL_STATS
+        uint32_t currentGeneration = generation_.load(std::memory_order_relaxed);
+        if (shard->generation.load(std::memory_order_relaxed) != currentGeneration) {
+            shard->clear(currentGeneration);
+        }
+        uint64_t run = elapsed(started, finished);
+        shard->queueWait.record(elapsed(submitted, started));
+        shard->execution.record(run);
+        shard->endToEnd.record(elapsed(submitted, finished));
+        detail::OSALShardHistogram::add(shard->workerCompleted, 1);
+        detail::OSALShardHistogram::add(shard->workerBusyUs, run);
+#endif
+    }
+
+    // 清零所有统计, 与正在执行的任务并发时个别记录可能计入重置前或重置后
+    void reset(uint64_t now) {
+        sinceUs_.store(now, std::memory_order_relaxed);
+        submitted_.store(0, std::memory_order_relaxed);
+        rejected_.store(0, std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+        ranInCaller_.store(0, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] ThreadPoolStats snapshot(uint64_t now) const {
+        ThreadPoolStats stats{};
+        uint64_t since = sinceUs_.load(std::memory_order_relaxed);
+        uint32_t currentGeneration = generation_.load(std::memory_order_relaxed);
+        stats.elapsedUs = elapsed(since, now);
+        stats.tasksSubmitted = submitted_.load(std::memory_order_relaxed);
+        stats.tasksRejected = rejected_.load(std::memory_order_relaxed);
+        stats.tasksDropped = dropped_.load(std::memory_order_relaxed);
+        stats.tasksRanInCaller = ranInCaller_.load(std::memory_order_relaxed);
+        uint64_t workerBusy = 0;
+        uint64_t workerAlive = 0;
+        OSALLockGuard lockGuard(mutex_);
+        for (const auto &shard : shards_) {
+            bool current = shard->generation.load(std::memory_order_relaxed) == currentGeneration;
+            if (current) {
+                shard->queueWait.mergeInto(stats.queueWait);
+                shard->execution.mergeInto(stats.execution);
+                shard->endToEnd.mergeInto(stats.endToEnd);
+            }
+            if (!shard->inUse.load(std::memory_order_relaxed)) continue;
+            uint64_t alive = elapsed(std::max(shard->workerSinceUs.load(std::memory_order_relaxed), since), now);
+            uint64_t completed = current ? shard->workerCompleted.load(std::memory_order_relaxed) : 0;
+            uint64_t busy = current ? std::min(shard->workerBusyUs.load(std::memory_order_relaxed), alive) : 0;
+            stats.workers.push_back(
+                ThreadPoolWorkerStats{completed, busy, alive > 0 ? static_cast<double>(busy) / alive : 0.0});
+            workerBusy += busy;
+            workerAlive += alive;
+        }
+        stats.tasksCompleted = stats.execution.count;
+        stats.throughput = stats.elapsedUs > 0 ? stats.tasksCompleted * 1e6 / static_cast<double>(stats.elapsedUs) : 0;
+        stats.busyRatio = workerAlive > 0 ? static_cast<double>(workerBusy) / workerAlive : 0.0;
+        return stats;
+    }
+
+private:
+    // 时钟回绕或读取顺序交错时按0计算
+    static uint64_t elapsed(uint64_t from, uint64_t to) { return to > from ? to - from : 0; }
+
+    mutable OSALMutex mutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<uint64_t> submitted_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> ranInCaller_{0};
+    std::atomic<uint64_t> sinceUs_{0};
+    std::atomic<uint32_t> generation_{0};
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_THREAD_POOL_STATS_H__
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __OSAL_TIMER_QUEUE_H__
+#define __OSAL_TIMER_QUEUE_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "interface_thread_pool.h"
+#include "osal_chrono.h"
+#include "osal_condition_variable.h"
+#include "osal_lockguard.h"
+#include "osal_mutex.h"
+#include "osal_task_function.h"
+#include "osal_task_handle.h"
+#include "osal_thread.h"
+
+namespace osal {
+
+// 线程池的延时任务队列: 所有延时和周期任务放在一个按截止时间排序的最小堆中, 由一个调度线程在最早的截止时间醒来,
+// 把到期任务交给dispatch放入就绪队列, 任务本身在线程池的工作线程上执行; 调度线程在第一次添加任务时才创建
+// 时间点为OSALChrono::now()的毫秒计数, 按有符号差值比较, 截止时间距当前时间不能超过2^31ms
+class OSALTimerQueue {
+public:
+    using TimePoint = OSALChrono::TimePoint;
+    using TaskFunction = OSALTaskFunction<>;
+    // 把到期任务交给线程池, 返回线程池的提交结果; 被拒绝的任务标记为已取消
+    using Dispatch = ThreadPoolSubmitStatus (*)(void *context, TaskFunction &&function, int priority);
+
+    OSALTimerQueue(Dispatch dispatch, void *context) : dispatch_(dispatch), context_(context) {}
+
+    ~OSALTimerQueue() { stop(); }
+
+    OSALTimerQueue(const OSALTimerQueue &) = delete;
+
+    OSALTimerQueue &operator=(const OSALTimerQueue &) = delete;
+
+    // 允许调度线程运行, 已有待触发的任务时立即创建调度线程
+    void start(int priority, int stack_size) {
+        OSALLockGuard lockGuard(mutex_);
+        priority_ = priority;
+        stackSize_ = stack_size;
+        enabled_ = true;
+        if (!heap_.empty()) {
+            startThreadLocked();
+        }
+    }
+
+    // 停止调度线程, 尚未到期的任务保留到下一次start()
+    void stop() {
+        std::unique_ptr<OSALThread> thread;
+        {
+            OSALLockGuard lockGuard(mutex_);
+            enabled_ = false;
+            thread = std::move(thread_);
+            condition_.notifyAll();
+        }
+        if (thread != nullptr) {
+            thread->join();
+        }
+    }
+
+    // 在deadline到期后提交function; control用于跳过到期前已取消的任务
+    template <typename F>
+    void schedule(TimePoint deadline, const detail::OSALTaskControlRef &control, F &&function, int priority) {
+        OSALLockGuard lockGuard(mutex_);
+        heap_.push_back(Entry{deadline, sequence_++, priority, control, TaskFunction(std::forward<F>(function))});
+        std::push_heap(heap_.begin(), heap_.end(), Later{});
+        if (enabled_ && thread_ == nullptr) {
+            startThreadLocked();
+        } else if (heap_.front().sequence == sequence_ - 1) {
+            // 新任务成为最早到期的任务, 调度线程需要缩短等待时间
+            condition_.notifyOne();
+        }
+    }
+
+    // 从first开始每隔period(ms)提交一次function, 直到control被取消; 按固定频率调度, 错过的周期被跳过
+    template <typename F>
+    void scheduleEvery(TimePoint first, uint32_t period, const detail::OSALTaskControlRef &control, F &&function,
+                       int priority) {
+        using State = Periodic<std::decay_t<F>>;
+        auto state = std::make_shared<State>(
+            State{this, std::max<uint32_t>(period, 1), priority, control, std::forward<F>(function)});
+        schedulePeriodic(std::move(state), first);
+    }
+
+    // 尚未到期的任务数, 包括已取消但还未出堆的任务
+    [[nodiscard]] size_t size() const {
+        OSALLockGuard lockGuard(mutex_);
+        return heap_.size();
+    }
+
+    static bool isBefore(TimePoint a, TimePoint b) { return static_cast<int32_t>(a - b) < 0; }
+
+private:
+    struct Entry {
+        TimePoint deadline;
+        uint64_t sequence;  // 截止时间相同时按添加顺序触发
+        int priority;
+        detail::OSALTaskControlRef control;
+        TaskFunction function;
+    };
+
+    // std::push_heap构造大顶堆, 反向比较得到最早到期的任务在堆顶
+    struct Later {
+        bool operator()(const Entry &a, const Entry &b) const {
+            if (a.deadline != b.deadline) return isBefore(b.deadline, a.deadline);
+            return a.sequence > b.sequence;
+        }
+    };
+
+    template <typename F>
+    struct Periodic {
+        OSALTimerQueue *queue;
+        uint32_t period;
+        int priority;
+        detail::OSALTaskControlRef control;
+        F function;
+    };
+
+    // 每次触发只提交一个持有共享状态的小闭包, 执行完后再把下一次触发放回堆中
+    template <typename P>
+    void schedulePeriodic(std::shared_ptr<P> state, TimePoint deadline) {
+        const detail::OSALTaskControlRef &control = state->control;
+        int priority = state->priority;
+        schedule(
+            deadline, control,
+            [state = std::move(state), deadline]() mutable {
+                if (!OSALTaskHandle::runPeriodic(state->control, state->function)) return;
+                TimePoint next = deadline + state->period;
+                TimePoint now = OSALChrono::getInstance().now();
+                if (!isBefore(now, next)) {
+                    next += ((now - next) / state->period + 1) * state->period;
+                }
+                OSALTimerQueue *queue = state->queue;
+                queue->schedulePeriodic(std::move(state), next);
+            },
+            priority);
+    }
+
+    // 调用方持有mutex_
+    void startThreadLocked() {
+        thread_ = std::make_unique<OSALThread>();
+        thread_->start("ThreadPoolTimer", threadEntry, this, priority_, stackSize_);
+    }
+
+    static void threadEntry(void *arg) { static_cast<OSALTimerQueue *>(arg)->threadLoop(); }
+
+    void threadLoop() {
+        std::vector<Entry> due;
+        while (true) {
+            {
+                OSALLockGuard lockGuard(mutex_);
+                while (enabled_ && !popDueLocked(due)) {
+                    waitLocked();
+                }
+                if (!enabled_) break;
+            }
+            // 在锁外提交, 线程池的Block策略可能阻塞在这里, 期间仍可以添加新任务
+            for (auto &entry : due) {
+                ThreadPoolSubmitStatus status = dispatch_(context_, std::move(entry.function), entry.priority);
+                if (status == ThreadPoolSubmitStatus::Rejected || status == ThreadPoolSubmitStatus::Timeout) {
+                    entry.control->cancel();
+                }
+            }
+            due.clear();
+        }
+        // 停止时已取出但未提交的任务放回堆中
+        if (!due.empty()) {
+            OSALLockGuard lockGuard(mutex_);
+            for (auto &entry : due) {
+                heap_.push_back(std::move(entry));
+                std::push_heap(heap_.begin(), heap_.end(), Later{});
+            }
+        }
+    }
+
+    // 取出所有已到期的任务, 到期前已取消的任务直接丢弃
+    bool popDueLocked(std::vector<Entry> &due) {
+        TimePoint now = OSALChrono::getInstance().now();
+        while (!heap_.empty() && !isBefore(now, heap_.front().deadline)) {
+            std::pop_heap(heap_.begin(), heap_.end(), Later{});
+            if (heap_.back().control->state() != detail::OSALTaskControl::kCancelled) {
+                due.push_back(std::move(heap_.back()));
+            }
+            heap_.pop_back();
+        }
+        return !due.empty();
+    }
+
+    void waitLocked() {
+        if (heap_.empty()) {
+            condition_.wait(mutex_);
+            return;
+        }
+        auto remaining = static_cast<int32_t>(heap_.front().deadline - OSALChrono::getInstance().now());
+        if (remaining > 0) {
+            condition_.waitFor(mutex_, static_cast<uint32_t>(remaining));
+        }
+    }
+
+    Dispatch dispatch_;
+    void *context_;
+    mutable OSALMutex mutex_;
+    OSALConditionVariable condition_;
+    std::vector<Entry> heap_;
+    uint64_t sequence_ = 0;
+    std::unique_ptr<OSALThread> thread_;
+    bool enabled_ = false;
+    int priority_ = 0;
+    int stackSize_ = 0;
+};
+
+}  // namespace osal
+
+#endif  // __OSAL_TIMER_QUEUE_H__
@@ -25,19 +25,30 @@
 #ifndef __OSAL_MESSAGE_QUEUE_H__
 #define __OSAL_MESSAGE_QUEUE_H__
 
+#include <bit>
+#include <cstdlib>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
 #include "osal.h"
 #include "interface_queue.h"
 #include "osal_debug.h"
 
 namespace osal {
 
+// cmsis_os的消息队列按sizeof逐字节拷贝消息, 只有可平凡拷贝的类型直接存放在队列中;
+// 其他类型(如持有vector或string的消息)在堆上构造, 队列中只传递指针, 接收时移出消息并释放
 template <typename T>
 class OSALMessageQueue : public MessageQueue<T> {
+    static constexpr bool kStoredByPointer = !std::is_trivially_copyable_v<T>;
+    using Stored = std::conditional_t<kStoredByPointer, T *, T>;
+
 public:
     explicit OSALMessageQueue(uint32_t queue_size = 16) {
         osMessageQueueAttr_t queueAttr = {};
         queueAttr.name = "MessageQueue";
-        queue_ = osMessageQueueNew(queue_size, sizeof(T), &queueAttr);
+        queue_ = osMessageQueueNew(queue_size, sizeof(Stored), &queueAttr);
         if (queue_ == nullptr) {
             OSAL_LOGE("Failed to create message queue\n");
             // 处理消息队列创建失败的情况
@@ -46,31 +57,55 @@ public:
 
     ~OSALMessageQueue() override {
         if (queue_ != nullptr) {
+            if constexpr (kStoredByPointer) {
+                clear();  // 释放仍在队列中的消息
+            }
             osMessageQueueDelete(queue_);
         }
     }
 
-    void send(const T &message) override {
-        if (osMessageQueuePut(queue_, &message, 0, osWaitForever) != osOK) {
-            OSAL_LOGE("Failed to send message\n");
-        } else {
-            OSAL_LOGD("Message sent\n");
-        }
+    void send(const T &message) override { emplace(message); }
+
+    void send(T &&message) override { emplace(std::move(message)); }
+
+    // 优先级作为msg_prio交给内核排序; 部分CMSIS-RTOS2适配层(如FreeRTOS)忽略msg_prio, 此时仍按到达顺序接收
+    void send(const T &message, uint8_t priority) override { put(priority, message); }
+
+    void send(T &&message, uint8_t priority) override { put(priority, std::move(message)); }
+
+    // 用参数构造优先级为0的消息后发送, 队列已满时阻塞等待空位
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        put(0, std::forward<Args>(args)...);
     }
 
+    // 队列已满时立即返回false, 消息保持不变
+    bool trySend(const T &message) { return emplaceFor(0, 0, message); }
+
+    bool trySend(T &&message) { return emplaceFor(0, 0, std::move(message)); }
+
+    // 最多等待timeout毫秒直到有空位, 超时返回false, 消息保持不变
+    bool sendFor(const T &message, uint32_t timeout) { return emplaceFor(timeout, 0, message); }
+
+    bool sendFor(T &&message, uint32_t timeout) { return emplaceFor(timeout, 0, std::move(message)); }
+
     T receive() override {
-        T message;
-        if (osMessageQueueGet(queue_, &message, nullptr, osWaitForever) != osOK) {
+        std::optional<T> message = take(osWaitForever);
+        if (!message) {
+            // 永久等待只会因参数错误失败(如队列创建失败或在中断中调用), 没有消息可返回
             OSAL_LOGE("Failed to receive message\n");
-            // 处理接收消息失败的情况
-        } else {
-            OSAL_LOGD("Message received\n");
+            if constexpr (std::is_default_constructible_v<T>) {
+                return T();
+            } else {
+                std::abort();
+            }
         }
-        return message;
+        OSAL_LOGD("Message received\n");
+        return std::move(*message);
     }
 
     bool tryReceive(T &message) override {
-        if (osMessageQueueGet(queue_, &message, nullptr, 0) != osOK) {
+        if (!get(message, 0)) {
             return false;
         }
         OSAL_LOGD("Message try-received\n");
@@ -78,24 +113,107 @@ public:
     }
 
     bool receiveFor(T &message, uint32_t timeout) override {
-        if (osMessageQueueGet(queue_, &message, nullptr, timeout) != osOK) {
+        if (!get(message, timeout)) {
             return false;
         }
         OSAL_LOGD("Message received with timeout\n");
         return true;
     }
 
+    // 已有消息时以零超时逐条取出, 不再进入阻塞等待
+    size_t receiveBatch(T *out, size_t maxCount) override {
+        size_t count = 0;
+        while (count < maxCount && get(out[count], 0)) {
+            ++count;
+        }
+        return count;
+    }
+
+    size_t receiveBatchFor(T *out, size_t maxCount, uint32_t timeout) override {
+        if (maxCount == 0 || !get(out[0], timeout)) {
+            return 0;
+        }
+        return 1 + receiveBatch(out + 1, maxCount - 1);
+    }
+
     [[nodiscard]] size_t size() const override { return osMessageQueueGetCount(queue_); }
 
+    [[nodiscard]] size_t capacity() const { return osMessageQueueGetCapacity(queue_); }
+
     void clear() override {
         while (osMessageQueueGetCount(queue_) > 0) {
-            T message;
-            osMessageQueueGet(queue_, &message, nullptr, 0);
+            take(0);
         }
         OSAL_LOGD("Message queue cleared\n");
     }
 
 private:
+    template <typename>
+    friend class OSALAsyncMessageQueue;
+
+    template <typename... Args>
+    static Stored makeStored(Args &&...args) {
+        if constexpr (kStoredByPointer) {
+            return new T(std::forward<Args>(args)...);
+        } else {
+            return T(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename... Args>
+    void put(uint8_t priority, Args &&...args) {
+        if (!emplaceFor(osWaitForever, priority, std::forward<Args>(args)...)) {
+            OSAL_LOGE("Failed to send message\n");
+        } else {
+            OSAL_LOGD("Message sent\n");
+        }
+    }
+
+    // 放入失败时释放堆上的消息; 若参数是被移入的消息本身, 先把内容移回, 调用方可以用它重试
+    template <typename... Args>
+    bool emplaceFor(uint32_t timeout, uint8_t priority, Args &&...args) {
+        Stored stored = makeStored(std::forward<Args>(args)...);
+        if (osMessageQueuePut(queue_, &stored, MessageQueue<T>::priorityLevel(priority), timeout) == osOK) {
+            return true;
+        }
+        if constexpr (kStoredByPointer) {
+            if constexpr (sizeof...(Args) == 1 && (std::is_same_v<Args, T> && ...)) {
+                ((args = std::move(*stored)), ...);
+            }
+            delete stored;
+        }
+        return false;
+    }
+
+    // 取出一条消息并移动到message中
+    bool get(T &message, uint32_t timeout) {
+        std::optional<T> taken = take(timeout);
+        if (!taken) {
+            return false;
+        }
+        message = std::move(*taken);
+        return true;
+    }
+
+    // 不等待地取出一条消息, 队列为空时返回空
+    std::optional<T> tryTake() { return take(0); }
+
+    // 取出一条消息, 超时或失败时返回空; 消息类型不需要默认构造
+    std::optional<T> take(uint32_t timeout) {
+        alignas(Stored) unsigned char buffer[sizeof(Stored)];
+        if (osMessageQueueGet(queue_, buffer, nullptr, timeout) != osOK) {
+            return std::nullopt;
+        }
+        Stored stored = std::bit_cast<Stored>(buffer);
+        if constexpr (kStoredByPointer) {
+            std::optional<T> message(std::move(*stored));
+            delete stored;
+            return message;
+        } else {
+            return stored;
+        }
+    }
+
     osMessageQueueId_t queue_;
 };
 
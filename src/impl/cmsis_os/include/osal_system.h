@@ -46,6 +46,8 @@ public:
 
     void sleep(const uint32_t seconds) const override { osDelay(seconds * 1000); }
 
+    void yield() const override { osThreadYield(); }
+
     [[nodiscard]] const char *get_system_info() const override {
         // Return some basic system information
         return "CMSIS-RTOS2 System";
@@ -61,8 +61,10 @@ public:
                                   ? stack_size
                                   : OSAL_CONFIG_THREAD_MINIMAL_STACK_SIZE;
 
-            if (pstack != nullptr) {
+            // 调用方提供栈内存时stack_size即为该内存的大小, 不能再按最小栈大小放大
+            if (pstack != nullptr && stack_size > 0) {
                 attr.stack_mem = pstack;
+                attr.stack_size = stack_size;
             }
             exitSemaphore = osSemaphoreNew(1, 0, nullptr);
             if (exitSemaphore == nullptr) {
@@ -73,6 +75,9 @@ public:
             threadHandle = osThreadNew(reinterpret_cast<osThreadFunc_t>(taskRunner), this, &attr);
             if (threadHandle != nullptr) {
                 running = true;
+                if (affinity_ != 0) {
+                    applyAffinity();
+                }
                 OSAL_LOGD("Thread started successfully\n");
                 return 0;  // 成功
             } else {
@@ -122,8 +127,12 @@ public:
     }
 
     void join() override {
-        if (isRunning()) {
+        if (threadHandle) {
+            // 线程退出前会释放exitSemaphore, 之后线程已自行删除, 不能再对其句柄调用osThreadTerminate
             osSemaphoreAcquire(exitSemaphore, osWaitForever);
+            osSemaphoreDelete(exitSemaphore);
+            exitSemaphore = nullptr;
+            threadHandle = nullptr;
             running = false;
             OSAL_LOGD("Thread joined\n");
         }
@@ -152,7 +161,29 @@ public:
         return -1;  // 返回一个无效的优先级表示错误
     }
 
+    // CMSIS-RTOS2没有亲和性接口, 仅在FreeRTOS SMP(configUSE_CORE_AFFINITY)下映射为内核掩码
+    int setAffinity(OSALCpuSet cpuSet) override {
+        affinity_ = cpuSet;
+        if (!threadHandle) {
+            return 0;
+        }
+        return applyAffinity();
+    }
+
+    OSALCpuSet getAffinity() const override { return affinity_; }
+
 private:
+    int applyAffinity() {
+#if defined(configUSE_CORE_AFFINITY) && (configUSE_CORE_AFFINITY == 1) && (configNUMBER_OF_CORES > 1)
+        UBaseType_t mask = affinity_ != 0 ? static_cast<UBaseType_t>(affinity_) : tskNO_AFFINITY;
+        vTaskCoreAffinitySet(reinterpret_cast<TaskHandle_t>(threadHandle), mask);
+        OSAL_LOGD("Thread affinity set to 0x%lx\n", static_cast<unsigned long>(mask));
+        return 0;
+#else
+        return affinity_ != 0 ? -1 : 0;
+#endif
+    }
+
     static void taskRunner(void *parameters) {
         auto *thread = static_cast<OSALThread *>(parameters);
         if (thread->_taskFunction) {
@@ -169,6 +200,7 @@ private:
     std::atomic<bool> running;
     std::atomic<bool> suspended;
     osSemaphoreId_t exitSemaphore{};
+    OSALCpuSet affinity_ = 0;
 };
 }  // namespace osal
 
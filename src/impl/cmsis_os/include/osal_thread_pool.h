@@ -27,27 +27,48 @@
 
 #include <atomic>
 #include <functional>
+#include <iterator>
 #include <memory>
-#include <queue>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "osal.h"
 #include "interface_thread_pool.h"
 #include "osal_condition_variable.h"
+#include "osal_coroutine.h"
 #include "osal_debug.h"
+#include "osal_future.h"
 #include "osal_lockguard.h"
 #include "osal_mutex.h"
+#include "osal_priority_bucket_queue.h"
+#include "osal_spin_wait.h"
+#include "osal_task_function.h"
+#include "osal_task_handle.h"
 #include "osal_thread.h"
+#include "osal_thread_pool_stats.h"
+#include "osal_timer_queue.h"
 
 namespace osal {
 
 class OSALThreadPool : public IThreadPool {
 public:
+    using TaskFunction = OSALTaskFunction<>;
+
+    // 线程池中的任务, 可直接构造后通过submitBatch()批量提交
+    struct Task {
+        TaskFunction function;
+        void *argument;
+        int priority;
+        uint64_t submitTime = 0;  // 提交时间(us), 由线程池填写
+    };
+
     OSALThreadPool();
 
     ~OSALThreadPool() override;
 
-    void start(uint32_t numThreads, int priority = 0, int stack_size = 0) override;
+    int start(uint32_t numThreads, int priority = 0, int stack_size = 0) override;
 
     void stop() override;
 
@@ -59,7 +80,118 @@ public:
 
     bool isSuspended() const override;
 
-    void submit(std::function<void(void *)> taskFunction, void *taskArgument, int priority) override;
+    ThreadPoolSubmitStatus submit(std::function<void(void *)> taskFunction, void *taskArgument, int priority) override;
+
+    // 提交任意可调用对象(可带捕获)并返回future, 结果通过function(args...)的返回值获得
+    // 任务被拒绝或等待空位超时时闭包随之销毁, 返回的future立即就绪且isBroken()为true, 不能再调用get()
+    template <typename F, typename... Args,
+              typename R = std::invoke_result_t<std::decay_t<F> &, std::decay_t<Args> &...>>
+    OSALFuture<R> submit(F &&function, Args &&...args) {
+        OSALPromise<R> promise;
+        OSALFuture<R> future = promise.getFuture();
+        post([promise = std::move(promise), function = std::forward<F>(function),
+              ... arguments = std::forward<Args>(args)]() mutable { promise.setValueFrom(function, arguments...); });
+        return future;
+    }
+
+    // 提交不需要结果的可调用对象(可带捕获), 直接在就绪队列中构造, 闭包不超过OSAL_CONFIG_TASK_INLINE_SIZE时无堆分配
+    template <typename F, typename = std::enable_if_t<OSALTaskFunction<>::isCallable<std::decay_t<F>>>>
+    ThreadPoolSubmitStatus post(F &&function, int priority = 0) {
+        return enqueue(priority, std::forward<F>(function), nullptr);
+    }
+
+    // 提交可取消的任务, function无参或接受OSALCancellationToken; 返回的句柄可以O(1)取消尚未开始的任务
+    template <typename F, typename = std::enable_if_t<OSALTaskHandle::isTaskCallable<std::decay_t<F>>>>
+    OSALTaskHandle submitCancellable(F &&function, int priority = 0) {
+        auto control = detail::OSALTaskControlRef::create();
+        OSALTaskHandle handle(control);
+        ThreadPoolSubmitStatus status = post(
+            [control = std::move(control), function = std::forward<F>(function)]() mutable {
+                OSALTaskHandle::run(control, function);
+            },
+            priority);
+        // 被拒绝的任务不会再执行, 标记为已取消
+        if (status == ThreadPoolSubmitStatus::Rejected || status == ThreadPoolSubmitStatus::Timeout) {
+            handle.cancel();
+        }
+        return handle;
+    }
+
+    // 延时delay(ms)后在工作线程上执行function(无参或接受OSALCancellationToken), 返回的句柄可在到期前取消
+    template <typename F, typename = std::enable_if_t<OSALTaskHandle::isTaskCallable<std::decay_t<F>>>>
+    OSALTaskHandle submitAfter(uint32_t delay, F &&function, int priority = 0) {
+        return submitAt(OSALChrono::getInstance().now() + delay, std::forward<F>(function), priority);
+    }
+
+    // 在deadline(OSALChrono::now()的时间点)到达后执行function, 已过期的deadline立即执行
+    template <typename F, typename = std::enable_if_t<OSALTaskHandle::isTaskCallable<std::decay_t<F>>>>
+    OSALTaskHandle submitAt(OSALChrono::TimePoint deadline, F &&function, int priority = 0) {
+        auto control = detail::OSALTaskControlRef::create();
+        OSALTaskHandle handle(control);
+        timers_.schedule(
+            deadline, control,
+            [control, function = std::forward<F>(function)]() mutable { OSALTaskHandle::run(control, function); },
+            priority);
+        return handle;
+    }
+
+    // 每隔period(ms)执行一次function, 第一次在一个周期后执行; 执行耗时超过周期时跳过错过的触发, 不会并发执行
+    // 句柄的cancel()停止后续触发, status()在两次触发之间为Pending
+    template <typename F, typename = std::enable_if_t<OSALTaskHandle::isTaskCallable<std::decay_t<F>>>>
+    OSALTaskHandle submitEvery(uint32_t period, F &&function, int priority = 0) {
+        auto control = detail::OSALTaskControlRef::create();
+        OSALTaskHandle handle(control);
+        timers_.scheduleEvery(OSALChrono::getInstance().now() + period, period, control, std::forward<F>(function),
+                              priority);
+        return handle;
+    }
+
+#if OSAL_CONFIG_COROUTINE
+    // co_await pool.schedule(): 当前协程切换到线程池的工作线程上继续执行
+    OSALScheduleAwaiter<OSALThreadPool> schedule(int priority = 0) { return {*this, priority}; }
+
+    // co_await pool.sleepFor(delay): 挂起当前协程delay(ms), 到期后在工作线程上恢复, 等待期间不占用线程
+    OSALSleepAwaiter<OSALThreadPool> sleepFor(uint32_t delay, int priority = 0) { return {*this, delay, priority}; }
+#endif
+
+    // 尚未到期的延时和周期任务数
+    size_t getDelayedTaskCount() const { return timers_.size(); }
+
+    // 取消submitCancellable()提交的任务, 任务尚未开始时返回true; 已取消的任务留在队列中, 出队时被跳过
+    bool cancel(OSALTaskHandle &handle) { return handle.cancel(); }
+
+    // 在当前线程执行一个排队中的任务, 队列为空或线程池已暂停时返回false; 供等待子任务的线程帮忙执行,
+    // 工作线程在任务中等待同一线程池的其他任务时不会因线程全部阻塞而死锁
+    bool runPendingTask();
+
+    // 批量提交: 只加一次锁, 唤醒min(任务数, 空闲线程数)个线程; 任务被移入线程池
+    // 设置了队列容量时整批按溢出策略处理: Block等待整批的空位, 批量大于容量时等待队列清空;
+    // DropOldest最多丢弃全部排队任务
+    ThreadPoolSubmitStatus submitBatch(std::span<Task> tasks);
+
+    // 批量提交迭代器范围内的任务, 元素可以是Task或可调用对象(优先级为0); 连续存放的Task不做额外拷贝
+    template <typename It>
+    ThreadPoolSubmitStatus submitBatch(It first, It last) {
+        using Value = typename std::iterator_traits<It>::value_type;
+        if constexpr (std::is_same_v<Value, Task> && std::contiguous_iterator<It>) {
+            return submitBatch(std::span<Task>(first, last));
+        } else {
+            std::vector<Task> tasks;
+            tasks.reserve(static_cast<size_t>(std::distance(first, last)));
+            for (; first != last; ++first) {
+                if constexpr (std::is_same_v<Value, Task>) {
+                    tasks.push_back(std::move(*first));
+                } else {
+                    tasks.push_back(Task{TaskFunction(std::move(*first)), nullptr, 0});
+                }
+            }
+            return submitBatch(std::span<Task>(tasks));
+        }
+    }
+
+    void setQueueCapacity(size_t capacity, ThreadPoolOverflowPolicy policy, uint32_t timeout = 0) override;
+
+    size_t getQueueCapacity() const override;
 
     void setPriority(int priority) override;
 
@@ -81,25 +213,134 @@ public:
 
     uint32_t getMinThreads() const override;
 
+    void setPriorityAging(uint32_t interval) override;
+
+    uint32_t getPriorityAging() const override;
+
+    void setIdleTimeout(uint32_t timeout) override;
+
+    uint32_t getIdleTimeout() const override;
+
+    void setGrowThreshold(size_t queueDepth, uint32_t waitTime) override;
+
+    ThreadPoolScalingStats getScalingStats() const override;
+
+    ThreadPoolStats getStats() const override;
+
+    void resetStats() override;
+
+    void setAffinity(OSALCpuSet cpuSet, bool pinEach) override;
+
+    OSALCpuSet getAffinity() const override;
+
+    void setSpinPolicy(const ThreadPoolSpinPolicy &policy) override;
+
+    ThreadPoolSpinPolicy getSpinPolicy() const override;
+
 private:
-    struct Task {
-        std::function<void(void *)> function;
-        void *argument;
-        int priority;
-    };
+    // DropOldest策略从队列中移出的任务
+    using DroppedTasks = std::vector<Task>;
+
+    // 部分移植层的osThreadGetId()返回整数而非osThreadId_t, 按实际返回类型保存
+    using WorkerId = decltype(osThreadGetId());
 
     static void threadEntry(void *arg);
 
+    template <typename F>
+    ThreadPoolSubmitStatus enqueue(int priority, F &&function, void *argument) {
+        bool grow = false;
+        uint64_t submitted = statsTimestamp();
+        ThreadPoolSubmitStatus status;
+        DroppedTasks dropped;  // 在队列锁释放后销毁
+        {
+            OSALLockGuard lockGuard(queueMutex_);
+            status = admitLocked(1, dropped);
+            if (status == ThreadPoolSubmitStatus::Accepted) {
+                taskQueue_.emplace(priority, readyTimestamp(), std::forward<F>(function), argument, priority,
+                                   submitted);
+                submitEpoch_.fetch_add(1, std::memory_order_release);
+                grow = shouldGrowLocked();
+            }
+        }
+        if (status != ThreadPoolSubmitStatus::Accepted) {
+            return overflow(status, function, argument);
+        }
+        condition_.notifyOne();
+        stats_.recordSubmit(1);
+        onTaskSubmitted(grow);
+        return ThreadPoolSubmitStatus::Accepted;
+    }
+
+    // 延时任务到期后由调度线程放入就绪队列
+    static ThreadPoolSubmitStatus dispatchTimer(void *context, OSALTimerQueue::TaskFunction &&function, int priority) {
+        return static_cast<OSALThreadPool *>(context)->post(std::move(function), priority);
+    }
+
+    // 处理未被接收的任务: RanInCaller时在当前线程执行, 其余情况任务随闭包一起销毁
+    template <typename F>
+    ThreadPoolSubmitStatus overflow(ThreadPoolSubmitStatus status, F &function, void *argument) {
+        if (status == ThreadPoolSubmitStatus::RanInCaller) {
+            if constexpr (std::is_invocable_v<F &, void *>) {
+                function(argument);
+            } else {
+                function();
+            }
+            stats_.recordRanInCaller(1);
+        } else {
+            stats_.recordRejected(1);
+        }
+        return status;
+    }
+
+    ThreadPoolSubmitStatus overflowBatch(ThreadPoolSubmitStatus status, std::span<Task> tasks);
+
+    // 调用方持有queueMutex_; 为count个任务预留队列空位, 按溢出策略等待或丢弃排队任务, 返回Accepted表示可以入队
+    // 被丢弃的任务移入dropped, 由调用方在释放queueMutex_后销毁: 任务闭包的析构(如promise失效后执行的后继任务)
+    // 可能再次向本线程池提交任务
+    ThreadPoolSubmitStatus admitLocked(size_t count, DroppedTasks &dropped);
+
+    bool hasSpaceLocked(size_t count) const;
+
+    bool isWorkerThreadLocked() const;
+
+    void onTaskSubmitted(bool grow);
+
+    // 统计用的单调时钟(us), 关闭统计时返回0
+    static uint64_t statsTimestamp();
+
+    bool shouldGrowLocked() const;
+
+    bool waitForTask();
+
+    bool retireIdleWorker();
+
+    void reapRetiredWorkers();
+
+    bool isSpinEnabled() const;
+
+    bool claimHotThread();
+
+    template <typename Ready>
+    bool spinForTask(Ready &&ready);
+
+    uint32_t readyTimestamp() const;
+
+    OSALCpuSet nextWorkerAffinity();
+
     bool OSALAddTread();
 
     bool OSALDelTread();
 
     void threadLoop();
 
+    bool popReady(Task &task);
+
     std::vector<std::unique_ptr<OSALThread>> threads_;
-    std::queue<Task> taskQueue_;
+    OSALMutex threadsMutex_;  // 保护threads_, 扩容、回收与停止可能发生在不同线程
+    OSALPriorityBucketQueue<Task> taskQueue_;
     OSALMutex queueMutex_;
     OSALConditionVariable condition_;
+    OSALConditionVariable resumeCondition_;  // 暂停期间工作线程在此等待resume(), 配合queueMutex_使用
     std::atomic<bool> isstarted_;
     std::atomic<bool> suspended_;
     std::atomic<int> priority_;
@@ -108,6 +349,34 @@ private:
     std::atomic<uint32_t> maxThreads_;
     std::atomic<uint32_t> minThreads_;
     std::function<void(void *)> taskFailureCallback_;
+    uint32_t idleThreads_;                 // 正在休眠等待任务的线程数, 由queueMutex_保护
+    std::atomic<uint32_t> agingInterval_;  // 优先级老化间隔(ms), 0表示不启用
+    std::atomic<uint32_t> idleTimeout_;    // 空闲线程退出超时(ms), 0表示不收缩
+    std::atomic<size_t> growQueueDepth_;   // 触发扩容的排队任务数
+    std::atomic<uint32_t> growWaitTime_;   // 触发扩容的排队等待时间(ms), 0表示不检查
+    std::atomic<uint32_t> threadCount_;    // 未退出的线程数
+    std::atomic<uint32_t> retiredThreads_;  // 已退出等待回收的线程数
+    std::atomic<uint32_t> peakThreads_;
+    std::atomic<uint32_t> threadsCreated_;
+    std::atomic<uint32_t> threadsRetired_;
+    OSALThreadPoolStatsRegistry stats_;  // 任务耗时统计, 每个工作线程一个分片
+    std::atomic<OSALCpuSet> affinity_;
+    std::atomic<bool> pinEach_;
+    uint32_t affinityCursor_;  // 下一个线程绑定的CPU序号, 由threadsMutex_保护
+
+    std::atomic<size_t> queueCapacity_;                     // 任务队列容量, 0表示不限制
+    std::atomic<ThreadPoolOverflowPolicy> overflowPolicy_;  // 队列已满时的处理策略
+    std::atomic<uint32_t> overflowTimeout_;                 // Block策略等待空位的超时(ms), 0表示一直等待
+    uint32_t blockedSubmitters_;                            // 正在等待队列空位的提交线程数, 由queueMutex_保护
+    OSALConditionVariable spaceCondition_;                  // 队列出现空位时唤醒被阻塞的提交线程
+    std::vector<WorkerId> workerIds_;                       // 工作线程ID, 由queueMutex_保护
+
+    std::atomic<uint32_t> spinCount_;    // 空闲线程休眠前的自旋轮询次数
+    std::atomic<uint32_t> yieldCount_;   // 自旋后让出CPU的次数
+    std::atomic<uint32_t> hotThreads_;   // 始终自旋不休眠的空闲线程数
+    std::atomic<uint32_t> hotSpinners_;  // 正在作为热线程自旋的线程数
+    std::atomic<uint32_t> submitEpoch_;  // 每入队一次加一, 自旋中的线程据此发现新任务
+    OSALTimerQueue timers_;                                 // 延时和周期任务, 最后构造、最先析构
 };
 
 }  // namespace osal
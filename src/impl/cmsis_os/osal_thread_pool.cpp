@@ -24,59 +24,110 @@
 
 #include "osal_thread_pool.h"
 
+#include <algorithm>
+
+#include "osal_chrono.h"
+
 namespace osal {
 
 OSALThreadPool::OSALThreadPool()
-    : isstarted_(false), suspended_(false), priority_(0), stack_size_(0), activeThreads_(0), maxThreads_(0), minThreads_(0) {}
+    : isstarted_(false), suspended_(false), priority_(0), stack_size_(0), activeThreads_(0), maxThreads_(0), minThreads_(0),
+      idleThreads_(0), agingInterval_(0), idleTimeout_(0), growQueueDepth_(1), growWaitTime_(0), threadCount_(0),
+      retiredThreads_(0), peakThreads_(0), threadsCreated_(0), threadsRetired_(0),
+      affinity_(0), pinEach_(false), affinityCursor_(0), queueCapacity_(0),
+      overflowPolicy_(ThreadPoolOverflowPolicy::Block), overflowTimeout_(0), blockedSubmitters_(0),
+      spinCount_(0), yieldCount_(0), hotThreads_(0), hotSpinners_(0), submitEpoch_(0),
+      timers_(dispatchTimer, this) {}
 
 OSALThreadPool::~OSALThreadPool() { stop(); }
 
-void OSALThreadPool::start(uint32_t numThreads, int priority, int stack_size) {
+int OSALThreadPool::start(uint32_t numThreads, int priority, int stack_size) {
     stop();  // 停止任何现有的线程池
-    isstarted_ = true;
     minThreads_ = numThreads;
     maxThreads_ = numThreads;
     priority_ = priority;
     stack_size_ = stack_size;
+    peakThreads_ = 0;
+    threadsCreated_ = 0;
+    threadsRetired_ = 0;
+    stats_.reset(statsTimestamp());
+    isstarted_ = true;
     for (uint32_t i = 0; i < numThreads; ++i) {
         OSALThreadPool::OSALAddTread();
     }
-    OSAL_LOGD("Thread pool started with %u threads\n", numThreads);
+    if (numThreads > 0 && threadCount_ == 0) {
+        OSAL_LOGE("Failed to start thread pool: no worker thread could be created\n");
+        stop();
+        return -1;
+    }
+    timers_.start(priority, stack_size);
+    OSAL_LOGD("Thread pool started with %u/%u threads\n", static_cast<uint32_t>(threadCount_), numThreads);
+    return 0;
 }
 
 bool OSALThreadPool::OSALAddTread() {
+    OSALLockGuard lockGuard(threadsMutex_);
+    if (isstarted_ && threadCount_ >= maxThreads_) {
+        return false;
+    }
     auto thread = std::make_unique<OSALThread>();
     if (thread == nullptr) {
         OSAL_LOGE("Failed to create thread\n");
         return false;
     } else {
-        thread->start("ThreadPool", threadEntry, this, priority_, stack_size_);
+        thread->setAffinity(nextWorkerAffinity());
+        if (thread->start("ThreadPool", threadEntry, this, priority_, stack_size_) != 0) {
+            OSAL_LOGE("Failed to start thread pool worker\n");
+            return false;
+        }
         threads_.push_back(std::move(thread));
+        uint32_t count = ++threadCount_;
+        ++threadsCreated_;
+        if (count > peakThreads_) {
+            peakThreads_ = count;
+        }
         return true;
     }
 }
 
+// 回收一个已退出任务循环的线程, 释放其栈和线程控制块
 bool OSALThreadPool::OSALDelTread() {
-    bool result = false;
-    for (auto &thread : threads_) {
-        if (!thread->isRunning()) {
-            thread->stop();
-            threads_.erase(std::remove(threads_.begin(), threads_.end(), thread), threads_.end());
-            result = true;
-            break;
+    std::unique_ptr<OSALThread> retired;
+    {
+        OSALLockGuard lockGuard(threadsMutex_);
+        auto it = std::find_if(threads_.begin(), threads_.end(),
+                               [](const std::unique_ptr<OSALThread> &thread) { return !thread->isRunning(); });
+        if (it == threads_.end()) {
+            return false;
         }
+        retired = std::move(*it);
+        threads_.erase(it);
     }
-    return result;
+    retired->join();
+    --retiredThreads_;
+    return true;
 }
 
 void OSALThreadPool::stop() {
     isstarted_ = false;
-
-    condition_.notifyAll();
+    {
+        // 持锁广播: 已检查过isstarted_、即将休眠的线程都已计入等待数, 不会错过这次唤醒
+        // 线程池停止后提交的任务直接进入队列, 不再等待空位
+        OSALLockGuard lockGuard(queueMutex_);
+        condition_.notifyAll();
+        spaceCondition_.notifyAll();
+        resumeCondition_.notifyAll();
+    }
+    timers_.stop();  // 未到期的延时任务保留到下次启动
+    // 等待线程自行退出任务循环后回收, 不再强制终止: FreeRTOS不会释放被删除任务持有的互斥锁,
+    // 终止一个正持有queueMutex_或统计锁的线程会使之后的加锁永久阻塞; 正在执行的任务需先返回
+    OSALLockGuard lockGuard(threadsMutex_);
     for (auto &thread : threads_) {
-        thread->stop();
+        thread->join();
     }
     threads_.clear();
+    threadCount_ = 0;
+    retiredThreads_ = 0;
     OSAL_LOGD("Thread pool stopped\n");
 }
 
@@ -88,7 +139,11 @@ int OSALThreadPool::suspend() {
 
 int OSALThreadPool::resume() {
     suspended_ = false;
-    condition_.notifyAll();
+    {
+        // 持锁广播, 保证等待计数准确, 暂停期间停在闸门上的线程全部放行
+        OSALLockGuard lockGuard(queueMutex_);
+        resumeCondition_.notifyAll();
+    }
     OSAL_LOGD("Thread pool resumed\n");
     return 0;
 }
@@ -97,19 +152,233 @@ bool OSALThreadPool::isStarted() const { return isstarted_; }
 
 bool OSALThreadPool::isSuspended() const { return suspended_; }
 
-void OSALThreadPool::submit(std::function<void(void *)> taskFunction, void *taskArgument, int priority) {
+ThreadPoolSubmitStatus OSALThreadPool::submit(std::function<void(void *)> taskFunction, void *taskArgument,
+                                              int priority) {
+    // 普通函数指针直接存放, 不再包一层std::function
+    if (auto plain = taskFunction.target<void (*)(void *)>()) {
+        return enqueue(priority, *plain, taskArgument);
+    }
+    return enqueue(priority, std::move(taskFunction), taskArgument);
+}
+
+ThreadPoolSubmitStatus OSALThreadPool::submitBatch(std::span<Task> tasks) {
+    if (tasks.empty()) return ThreadPoolSubmitStatus::Accepted;
+    uint64_t submitted = statsTimestamp();
+    for (auto &task : tasks) {
+        task.submitTime = submitted;
+    }
+    size_t wakeups = 0;
+    bool grow = false;
+    ThreadPoolSubmitStatus status;
+    DroppedTasks dropped;  // 在队列锁释放后销毁
     {
         OSALLockGuard lockGuard(queueMutex_);
-        taskQueue_.emplace(Task{taskFunction, taskArgument, priority});
+        status = admitLocked(tasks.size(), dropped);
+        if (status == ThreadPoolSubmitStatus::Accepted) {
+            uint32_t now = readyTimestamp();
+            for (auto &task : tasks) {
+                int priority = task.priority;
+                taskQueue_.push(std::move(task), priority, now);
+            }
+            submitEpoch_.fetch_add(1, std::memory_order_release);
+            wakeups = std::min<size_t>(tasks.size(), idleThreads_);
+            grow = wakeups < tasks.size() && shouldGrowLocked();
+        }
+    }
+    if (status != ThreadPoolSubmitStatus::Accepted) {
+        return overflowBatch(status, tasks);
+    }
+    // 每次notifyOne都是一次信号量释放, 只唤醒确实在等待的线程
+    for (size_t i = 0; i < wakeups; ++i) {
+        condition_.notifyOne();
+    }
+    stats_.recordSubmit(tasks.size());
+    onTaskSubmitted(grow);
+    return ThreadPoolSubmitStatus::Accepted;
+}
+
+bool OSALThreadPool::runPendingTask() {
+    Task task;
+    {
+        OSALLockGuard lockGuard(queueMutex_);
+        if (suspended_ || !popReady(task)) return false;
+        if (blockedSubmitters_ > 0) {
+            spaceCondition_.notifyAll();
+        }
+    }
+    if (task.function == nullptr) {
+        if (taskFailureCallback_ != nullptr) {
+            taskFailureCallback_(task.argument);
+        }
+        return true;
+    }
+    // 帮忙执行的线程临时借用一个统计分片, 不计入活跃线程数
+    OSALThreadPoolStatsRegistry::Shard *shard = stats_.acquire(statsTimestamp());
+    uint64_t started = statsTimestamp();
+    task.function(task.argument);
+    stats_.recordTask(shard, task.submitTime, started, statsTimestamp());
+    stats_.release(shard);
+    return true;
+}
+
+ThreadPoolSubmitStatus OSALThreadPool::overflowBatch(ThreadPoolSubmitStatus status, std::span<Task> tasks) {
+    if (status == ThreadPoolSubmitStatus::RanInCaller) {
+        for (auto &task : tasks) {
+            if (task.function != nullptr) {
+                task.function(task.argument);
+            }
+        }
+        stats_.recordRanInCaller(tasks.size());
+    } else {
+        stats_.recordRejected(tasks.size());
+    }
+    return status;
+}
+
+ThreadPoolSubmitStatus OSALThreadPool::admitLocked(size_t count, DroppedTasks &dropped) {
+    size_t capacity = queueCapacity_;
+    if (capacity == 0 || taskQueue_.size() + count <= capacity) {
+        return ThreadPoolSubmitStatus::Accepted;
     }
-    condition_.notifyOne();
-    // 如果当前仍有任务堆积, 且已有线程池跑满，且未达到最大线程值
-    if (activeThreads_ == std::size(threads_) && activeThreads_ < maxThreads_) {
-        OSALAddTread();
+    switch (overflowPolicy_.load()) {
+        case ThreadPoolOverflowPolicy::Reject:
+            return ThreadPoolSubmitStatus::Rejected;
+        case ThreadPoolOverflowPolicy::CallerRuns:
+            return ThreadPoolSubmitStatus::RanInCaller;
+        case ThreadPoolOverflowPolicy::DropOldest: {
+            size_t excess = taskQueue_.size() + count - capacity;
+            size_t evicted = 0;
+            Task task;
+            while (evicted < excess && taskQueue_.popLowest(task)) {
+                dropped.push_back(std::move(task));
+                ++evicted;
+            }
+            stats_.recordDropped(evicted);
+            return ThreadPoolSubmitStatus::Accepted;
+        }
+        case ThreadPoolOverflowPolicy::Block:
+        default:
+            break;
+    }
+    // 工作线程等待自己所在线程池的空位可能导致所有线程互相等待, 改为在当前线程执行
+    if (isWorkerThreadLocked()) {
+        return ThreadPoolSubmitStatus::RanInCaller;
+    }
+    uint32_t timeout = overflowTimeout_;
+    uint32_t begin = OSALChrono::getInstance().now();
+    bool admitted = true;
+    ++blockedSubmitters_;
+    // 条件变量基于信号量, 可能残留多余的信号, 唤醒后重新检查
+    while (!hasSpaceLocked(count)) {
+        if (timeout == 0) {
+            spaceCondition_.wait(queueMutex_);
+            continue;
+        }
+        uint32_t waited = OSALChrono::getInstance().now() - begin;
+        if (waited >= timeout || !spaceCondition_.waitFor(queueMutex_, timeout - waited)) {
+            admitted = hasSpaceLocked(count);
+            break;
+        }
+    }
+    --blockedSubmitters_;
+    return admitted ? ThreadPoolSubmitStatus::Accepted : ThreadPoolSubmitStatus::Timeout;
+}
+
+// 调用方持有queueMutex_; 批量大于容量时等待队列清空, 否则永远等不到足够的空位
+bool OSALThreadPool::hasSpaceLocked(size_t count) const {
+    size_t queued = taskQueue_.size();
+    size_t capacity = queueCapacity_;
+    return !isstarted_ || capacity == 0 || queued + count <= capacity || queued == 0;
+}
+
+// 调用方持有queueMutex_
+bool OSALThreadPool::isWorkerThreadLocked() const {
+    return std::find(workerIds_.begin(), workerIds_.end(), osThreadGetId()) != workerIds_.end();
+}
+
+void OSALThreadPool::onTaskSubmitted(bool grow) {
+    reapRetiredWorkers();
+    if (grow && OSALAddTread()) {
+        OSAL_LOGD("Thread pool grown to %u threads\n", threadCount_.load());
     }
     OSAL_LOGD("Task submitted\n");
 }
 
+// 调用方持有queueMutex_; 空闲线程足以接走排队任务或已达到最大线程数时不扩容
+bool OSALThreadPool::shouldGrowLocked() const {
+    size_t depth = taskQueue_.size();
+    if (!isstarted_ || threadCount_ >= maxThreads_ || depth <= idleThreads_) {
+        return false;
+    }
+    uint32_t waitTime = growWaitTime_;
+    return depth - idleThreads_ >= growQueueDepth_ ||
+           (waitTime > 0 && taskQueue_.longestWait(OSALChrono::getInstance().now()) >= waitTime);
+}
+
+// 调用方持有queueMutex_, 返回false表示空闲超时
+bool OSALThreadPool::waitForTask() {
+    uint32_t timeout = idleTimeout_;
+    if (timeout == 0) {
+        condition_.wait(queueMutex_);
+        return true;
+    }
+    return condition_.waitFor(queueMutex_, timeout);
+}
+
+// 空闲超时的线程在线程数高于最小线程数时退出; 已退出的线程由其余线程空闲超时或退出时回收, 也由提交和stop()回收
+bool OSALThreadPool::retireIdleWorker() {
+    uint32_t count = threadCount_;
+    while (count > minThreads_) {
+        if (threadCount_.compare_exchange_weak(count, count - 1)) {
+            ++retiredThreads_;
+            ++threadsRetired_;
+            OSAL_LOGD("Idle thread retired, %u threads left\n", count - 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void OSALThreadPool::reapRetiredWorkers() {
+    while (retiredThreads_ > 0 && OSALDelTread()) {
+    }
+}
+
+bool OSALThreadPool::isSpinEnabled() const { return spinCount_ > 0 || yieldCount_ > 0 || hotThreads_ > 0; }
+
+bool OSALThreadPool::claimHotThread() {
+    uint32_t spinners = hotSpinners_;
+    while (spinners < hotThreads_) {
+        if (hotSpinners_.compare_exchange_weak(spinners, spinners + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 空闲线程休眠前的自旋阶段, 不持有队列锁, ready()为true时返回true;
+// 热线程一直自旋, 直到有新任务或线程池停止、暂停; 每轮自旋后osThreadYield()只让给同优先级的线程,
+// 热线程的优先级应不高于需要及时运行的其他线程
+template <typename Ready>
+bool OSALThreadPool::spinForTask(Ready &&ready) {
+    bool hot = claimHotThread();
+    OSALSpinWait wait(spinCount_, yieldCount_);
+    bool found = false;
+    while (isstarted_ && !suspended_) {
+        if (ready()) {
+            found = true;
+            break;
+        }
+        if (!wait.spinOnce()) {
+            if (!hot) break;
+            OSALSystem::getInstance().yield();
+            wait.reset();
+        }
+    }
+    if (hot) --hotSpinners_;
+    return found;
+}
+
 void OSALThreadPool::setPriority(int priority) {
     priority_ = priority;
     for (auto &thread : threads_) {
@@ -129,21 +398,12 @@ uint32_t OSALThreadPool::getActiveThreadCount() const { return activeThreads_; }
 
 bool OSALThreadPool::cancelTask(std::function<void(void *)> &taskFunction) {
     OSALLockGuard lockGuard(queueMutex_);
-    std::queue<Task> newQueue;
-    bool found = false;
     auto targetPtr = taskFunction.template target<void (*)(void *)>();
-    while (!taskQueue_.empty()) {
-        Task task = taskQueue_.front();
-        taskQueue_.pop();
+    bool found = taskQueue_.removeIf([targetPtr](const Task &task) {
         auto taskPtr = task.function.template target<void (*)(void *)>();
         // (!taskPtr && !targetPtr) 判断是为了处理两个空的 std::function 对象相等的情况。
-        if ((taskPtr && targetPtr && *taskPtr == *targetPtr) || (!taskPtr && !targetPtr)) {
-            found = true;
-        } else {
-            newQueue.push(task);
-        }
-    }
-    taskQueue_ = std::move(newQueue);
+        return (taskPtr && targetPtr && *taskPtr == *targetPtr) || (!taskPtr && !targetPtr);
+    }) > 0;
     OSAL_LOGD("Task %s\n", found ? "cancelled" : "not found");
     return found;
 }
@@ -160,6 +420,19 @@ void OSALThreadPool::setMaxThreads(uint32_t maxThreads) {
 
 uint32_t OSALThreadPool::getMaxThreads() const { return maxThreads_; }
 
+void OSALThreadPool::setQueueCapacity(size_t capacity, ThreadPoolOverflowPolicy policy, uint32_t timeout) {
+    {
+        OSALLockGuard lockGuard(queueMutex_);
+        queueCapacity_ = capacity;
+        overflowPolicy_ = policy;
+        overflowTimeout_ = timeout;
+        spaceCondition_.notifyAll();
+    }
+    OSAL_LOGD("Queue capacity set to %zu, overflow policy %d\n", capacity, static_cast<int>(policy));
+}
+
+size_t OSALThreadPool::getQueueCapacity() const { return queueCapacity_; }
+
 void OSALThreadPool::setMinThreads(uint32_t minThreads) {
     minThreads_ = minThreads;
     OSAL_LOGD("Min threads set to %u\n", minThreads);
@@ -167,29 +440,149 @@ void OSALThreadPool::setMinThreads(uint32_t minThreads) {
 
 uint32_t OSALThreadPool::getMinThreads() const { return minThreads_; }
 
+void OSALThreadPool::setPriorityAging(uint32_t interval) {
+    agingInterval_ = interval;
+    OSAL_LOGD("Priority aging interval set to %u ms\n", interval);
+}
+
+uint32_t OSALThreadPool::getPriorityAging() const { return agingInterval_; }
+
+void OSALThreadPool::setIdleTimeout(uint32_t timeout) {
+    idleTimeout_ = timeout;
+    OSAL_LOGD("Idle timeout set to %u ms\n", timeout);
+}
+
+uint32_t OSALThreadPool::getIdleTimeout() const { return idleTimeout_; }
+
+void OSALThreadPool::setGrowThreshold(size_t queueDepth, uint32_t waitTime) {
+    growQueueDepth_ = queueDepth > 0 ? queueDepth : 1;
+    growWaitTime_ = waitTime;
+    OSAL_LOGD("Grow threshold set to %zu tasks or %u ms\n", queueDepth, waitTime);
+}
+
+ThreadPoolScalingStats OSALThreadPool::getScalingStats() const {
+    return ThreadPoolScalingStats{threadCount_, peakThreads_, threadsCreated_, threadsRetired_};
+}
+
+ThreadPoolStats OSALThreadPool::getStats() const { return stats_.snapshot(statsTimestamp()); }
+
+void OSALThreadPool::resetStats() {
+    stats_.reset(statsTimestamp());
+    OSAL_LOGD("Thread pool stats reset\n");
+}
+
+void OSALThreadPool::setAffinity(OSALCpuSet cpuSet, bool pinEach) {
+    OSALLockGuard lockGuard(threadsMutex_);
+    affinity_ = cpuSet;
+    pinEach_ = pinEach;
+    affinityCursor_ = 0;
+    for (auto &thread : threads_) {
+        thread->setAffinity(nextWorkerAffinity());
+    }
+    OSAL_LOGD("Thread pool affinity set to 0x%llx%s\n", static_cast<unsigned long long>(cpuSet),
+              pinEach ? " (pinned)" : "");
+}
+
+OSALCpuSet OSALThreadPool::getAffinity() const { return affinity_; }
+
+void OSALThreadPool::setSpinPolicy(const ThreadPoolSpinPolicy &policy) {
+    spinCount_ = policy.spinCount;
+    yieldCount_ = policy.yieldCount;
+    hotThreads_ = policy.hotThreads;
+    OSAL_LOGD("Spin policy set to %u spins, %u yields, %u hot threads\n", policy.spinCount, policy.yieldCount,
+              policy.hotThreads);
+}
+
+ThreadPoolSpinPolicy OSALThreadPool::getSpinPolicy() const {
+    return ThreadPoolSpinPolicy{spinCount_, yieldCount_, hotThreads_};
+}
+
+// 调用方持有threadsMutex_
+OSALCpuSet OSALThreadPool::nextWorkerAffinity() {
+    OSALCpuSet cpuSet = affinity_;
+    if (cpuSet == 0 || !pinEach_) {
+        return cpuSet;
+    }
+    return cpuSetOf(cpuSetNth(cpuSet, affinityCursor_++));
+}
+
+uint64_t OSALThreadPool::statsTimestamp() {
+#if OSAL_CONFIG_THREAD_POOL_STATS
+    // 精度为内核节拍
+    return static_cast<uint64_t>(osKernelGetTickCount()) * 1000000u / osKernelGetTickFreq();
+#else
+    return 0;
+#endif
+}
+
 void OSALThreadPool::threadEntry(void *arg) {
     auto *pool = static_cast<OSALThreadPool *>(arg);
     pool->threadLoop();
 }
 
+uint32_t OSALThreadPool::readyTimestamp() const {
+    return agingInterval_ > 0 || growWaitTime_ > 0 ? OSALChrono::getInstance().now() : 0;
+}
+
+bool OSALThreadPool::popReady(Task &task) {
+    uint32_t interval = agingInterval_;
+    return taskQueue_.pop(task, interval > 0 ? OSALChrono::getInstance().now() : 0, interval);
+}
+
 void OSALThreadPool::threadLoop() {
+    OSALThreadPoolStatsRegistry::Shard *shard = stats_.acquire(statsTimestamp());
+    {
+        OSALLockGuard lockGuard(queueMutex_);
+        workerIds_.push_back(osThreadGetId());
+    }
     while (isstarted_) {
         Task task;
         {
             OSALLockGuard lockGuard(queueMutex_);
-            condition_.wait(queueMutex_);
+            // 队列非空时直接取任务, 不再要求每个任务对应一次唤醒, 批量提交只需唤醒空闲线程
+            bool retire = false;
+            bool spun = false;
+            while ((taskQueue_.empty() || suspended_) && isstarted_) {
+                if (suspended_) {
+                    // 暂停期间停在恢复闸门上, 新提交的任务只入队、不会把线程唤醒空转
+                    resumeCondition_.wait(queueMutex_);
+                    continue;
+                }
+                if (!spun && !suspended_ && isSpinEnabled()) {
+                    // 先不休眠, 释放锁自旋等待入队计数变化, 省去提交方的信号量释放和线程切换延迟
+                    spun = true;
+                    uint32_t epoch = submitEpoch_;
+                    queueMutex_.unlock();
+                    spinForTask([this, epoch] { return submitEpoch_.load(std::memory_order_acquire) != epoch; });
+                    queueMutex_.lock();
+                    continue;
+                }
+                ++idleThreads_;
+                bool signalled = waitForTask();
+                --idleThreads_;
+                if (!signalled && taskQueue_.empty() && isstarted_ && retireIdleWorker()) {
+                    retire = true;
+                    break;
+                }
+                if (!signalled && retiredThreads_ > 0) {
+                    queueMutex_.unlock();
+                    reapRetiredWorkers();
+                    queueMutex_.lock();
+                }
+            }
 
-            if (!isstarted_) break;
-            if (suspended_) continue;
-            if (!taskQueue_.empty()) {
-                task = taskQueue_.front();
-                taskQueue_.pop();
+            if (!isstarted_ || retire) break;
+            popReady(task);
+            if (blockedSubmitters_ > 0) {
+                spaceCondition_.notifyAll();
             }
         }
 
         if (task.function != nullptr) {
             ++activeThreads_;
+            uint64_t started = statsTimestamp();
             task.function(task.argument);
+            stats_.recordTask(shard, task.submitTime, started, statsTimestamp());
             --activeThreads_;
         } else {
             if (taskFailureCallback_ != nullptr) {
@@ -197,6 +590,12 @@ void OSALThreadPool::threadLoop() {
             }
         }
     }
+    {
+        OSALLockGuard lockGuard(queueMutex_);
+        workerIds_.erase(std::remove(workerIds_.begin(), workerIds_.end(), osThreadGetId()), workerIds_.end());
+    }
+    if (isstarted_) reapRetiredWorkers();  // 空闲退出时回收此前退出的线程
+    stats_.release(shard);
 }
 
 }  // namespace osal
\ No newline at end of file
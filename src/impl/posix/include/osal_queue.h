@@ -27,55 +27,82 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
-#include <queue>
+#include <optional>
+#include <span>
+#include <utility>
 
 #include "interface_queue.h"
 #include "osal_debug.h"
+#include "osal_priority_bucket_queue.h"
 
 namespace osal {
 
+// 有界消息队列, 容量与cmsis_os实现一致: 队列满时send阻塞, 生产者和消费者分别在notFull_和notEmpty_上等待
+// 每个优先级一个环形缓冲区, 按优先级入队和出队均为O(1)
 template <typename T>
 class OSALMessageQueue : public MessageQueue<T> {
 public:
-    OSALMessageQueue() = default;
+    explicit OSALMessageQueue(uint32_t queue_size = 16) : capacity_(queue_size > 0 ? queue_size : 1) {}
 
     ~OSALMessageQueue() = default;
 
-    void send(const T &message) override {
-        std::lock_guard<std::mutex> lock(mutex_);
-        queue_.push(message);
+    void send(const T &message) override { emplace(message); }
+
+    void send(T &&message) override { emplace(std::move(message)); }
+
+    void send(const T &message, uint8_t priority) override {
+        emplaceFor(kWaitForever, priority, message);
+        OSAL_LOGD("Message sent with priority %u\n", static_cast<unsigned>(priority));
+    }
+
+    void send(T &&message, uint8_t priority) override {
+        emplaceFor(kWaitForever, priority, std::move(message));
+        OSAL_LOGD("Message sent with priority %u\n", static_cast<unsigned>(priority));
+    }
+
+    // 在队列存储中直接构造优先级为0的消息, 队列已满时阻塞等待空位
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        emplaceFor(kWaitForever, 0, std::forward<Args>(args)...);
         OSAL_LOGD("Message sent\n");
-        condVar_.notify_one();
     }
 
+    // 队列已满时立即返回false, 消息保持不变
+    bool trySend(const T &message) { return emplaceFor(0, 0, message); }
+
+    bool trySend(T &&message) { return emplaceFor(0, 0, std::move(message)); }
+
+    // 最多等待timeout毫秒直到有空位, 超时返回false, 消息保持不变
+    bool sendFor(const T &message, uint32_t timeout) { return emplaceFor(timeout, 0, message); }
+
+    bool sendFor(T &&message, uint32_t timeout) { return emplaceFor(timeout, 0, std::move(message)); }
+
     T receive() override {
         std::unique_lock<std::mutex> lock(mutex_);
-        condVar_.wait(lock, [this] { return !queue_.empty(); });
-        T message = queue_.front();
-        queue_.pop();
+        notEmpty_.wait(lock, [this] { return !queue_.empty(); });
+        T message = takeLocked();
         OSAL_LOGD("Message received\n");
         return message;
     }
 
     bool tryReceive(T &message) override {
         std::lock_guard<std::mutex> lock(mutex_);
-        if (queue_.empty()) {
+        if (!popLocked(message)) {
             return false;
         }
-        message = queue_.front();
-        queue_.pop();
         OSAL_LOGD("Message try-received\n");
         return true;
     }
 
     bool receiveFor(T &message, uint32_t timeout) override {
         std::unique_lock<std::mutex> lock(mutex_);
-        if (!condVar_.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return !queue_.empty(); })) {
+        if (!notEmpty_.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return !queue_.empty(); })) {
             return false;
         }
-        message = queue_.front();
-        queue_.pop();
+        popLocked(message);
         OSAL_LOGD("Message received with timeout\n");
         return true;
     }
@@ -85,17 +112,117 @@ public:
         return queue_.size();
     }
 
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+    // 每次放入空位能容纳的部分后只通知一次, 批量大于容量时分段等待空位
+    void sendBatch(std::span<const T> messages) override {
+        size_t sent = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (sent < messages.size()) {
+            notFull_.wait(lock, [this] { return queue_.size() < capacity_; });
+            size_t first = sent;
+            while (sent < messages.size() && queue_.size() < capacity_) {
+                queue_.emplace(0, 0, messages[sent++]);
+            }
+            notify(notEmpty_, sent - first);
+        }
+        OSAL_LOGD("Message batch sent\n");
+    }
+
+    size_t receiveBatch(T *out, size_t maxCount) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return drainLocked(out, maxCount);
+    }
+
+    size_t receiveBatchFor(T *out, size_t maxCount, uint32_t timeout) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (maxCount == 0 ||
+            !notEmpty_.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return !queue_.empty(); })) {
+            return 0;
+        }
+        return drainLocked(out, maxCount);
+    }
+
     void clear() override {
         std::lock_guard<std::mutex> lock(mutex_);
-        std::queue<T> empty;
-        std::swap(queue_, empty);
+        queue_.clear();
+        notFull_.notify_all();
         OSAL_LOGD("Message queue cleared\n");
     }
 
 private:
+    template <typename>
+    friend class OSALAsyncMessageQueue;
+
+    static constexpr uint32_t kWaitForever = UINT32_MAX;
+
+    // 等到有空位后构造消息; 超时时不使用参数
+    template <typename... Args>
+    bool emplaceFor(uint32_t timeout, uint8_t priority, Args &&...args) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto hasSpace = [this] { return queue_.size() < capacity_; };
+        if (timeout == kWaitForever) {
+            notFull_.wait(lock, hasSpace);
+        } else if (!notFull_.wait_for(lock, std::chrono::milliseconds(timeout), hasSpace)) {
+            return false;
+        }
+        queue_.emplace(MessageQueue<T>::priorityLevel(priority), 0, std::forward<Args>(args)...);
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    // 调用方持有mutex_; 取出优先级最高的消息
+    bool popLocked(T &message) {
+        if (queue_.empty()) {
+            return false;
+        }
+        message = takeLocked();
+        return true;
+    }
+
+    // 不等待地取出一条消息, 队列为空时返回空; 消息类型不需要默认构造
+    std::optional<T> tryTake() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+            return std::nullopt;
+        }
+        return takeLocked();
+    }
+
+    // 调用方持有mutex_且队列非空, 消息类型不需要默认构造
+    T takeLocked() {
+        T message = queue_.popFront();
+        notFull_.notify_one();
+        return message;
+    }
+
+    // 调用方持有mutex_
+    size_t drainLocked(T *out, size_t maxCount) {
+        size_t count = 0;
+        while (count < maxCount && queue_.pop(out[count])) {
+            ++count;
+        }
+        if (count > 0) {
+            notify(notFull_, count);
+            OSAL_LOGD("Message batch received\n");
+        }
+        return count;
+    }
+
+    // 状态变化只够一个等待者使用时只唤醒一个, 否则全部唤醒
+    static void notify(std::condition_variable &condition, size_t count) {
+        if (count == 1) {
+            condition.notify_one();
+        } else if (count > 1) {
+            condition.notify_all();
+        }
+    }
+
+    const size_t capacity_;
     mutable std::mutex mutex_;
-    std::queue<T> queue_;
-    std::condition_variable condVar_;
+    OSALPriorityBucketQueue<T, OSAL_CONFIG_MESSAGE_QUEUE_PRIORITY_LEVELS> queue_;
+    std::condition_variable notEmpty_;  // 消费者等待队列非空
+    std::condition_variable notFull_;   // 生产者等待队列有空位
 };
 
 }  // namespace osal
@@ -43,8 +43,10 @@ public:
     }
 
     void StartScheduler() override {
-        // POSIX 系统不需要显式启动调度器
-        while (1);
+        // POSIX 系统不需要显式启动调度器, 调用线程休眠而不是忙等, 避免占满一个CPU
+        while (1) {
+            std::this_thread::sleep_for(std::chrono::hours(1));
+        }
     }
 
     void sleep_ms(const uint32_t milliseconds) const override {
@@ -53,6 +55,8 @@ public:
 
     void sleep(const uint32_t seconds) const override { std::this_thread::sleep_for(std::chrono::seconds(seconds)); }
 
+    void yield() const override { std::this_thread::yield(); }
+
     const char *get_system_info() const override {
         // 返回一些基本的系统信息
         return "POSIX System";
@@ -84,6 +84,17 @@ public:
                 pthread_attr_setschedparam(&attr, &schedParam);
             }
 
+            // 设置CPU亲和性, 线程从第一条指令起就运行在指定的CPU上
+#if defined(__linux__)
+            if (affinity_ != 0) {
+                cpu_set_t cpus = toCpuSet(affinity_);
+                int affinityResult = pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+                if (affinityResult != 0) {
+                    OSAL_LOGE("Failed to set thread affinity: %s\n", strerror(affinityResult));
+                }
+            }
+#endif
+
             // 设置线程分离状态
             pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
 
@@ -92,6 +103,7 @@ public:
                 running = true;
                 OSAL_LOGD("Thread started successfully\n");
             } else {
+                threadHandle = 0;  // 创建失败时句柄内容未定义, 清零以免stop()对其pthread_join
                 OSAL_LOGE("Failed to create thread: %s\n", strerror(result));
             }
 
@@ -108,6 +120,7 @@ public:
             }
             pthread_cancel(threadHandle);
             pthread_join(threadHandle, nullptr);
+            threadHandle = 0;
             OSAL_LOGD("OSALThread destructor called, canceling thread\n");
         }
     }
@@ -130,6 +143,7 @@ public:
     void join() override {
         if (threadHandle) {
             pthread_join(threadHandle, nullptr);
+            threadHandle = 0;
             OSAL_LOGD("Thread joined\n");
         }
     }
@@ -163,7 +177,58 @@ public:
         return -1;  // 返回一个无效的优先级表示错误
     }
 
+    int setAffinity(OSALCpuSet cpuSet) override {
+        affinity_ = cpuSet;
+        if (!threadHandle) {
+            return 0;
+        }
+#if defined(__linux__)
+        cpu_set_t cpus = toCpuSet(cpuSet);
+        int result = pthread_setaffinity_np(threadHandle, sizeof(cpus), &cpus);
+        if (result != 0) {
+            OSAL_LOGE("Failed to set thread affinity: %s\n", strerror(result));
+            return -1;
+        }
+        OSAL_LOGD("Thread affinity set to 0x%llx\n", static_cast<unsigned long long>(cpuSet));
+        return 0;
+#else
+        return -1;
+#endif
+    }
+
+    // 未限制时返回0, 与cmsis_os后端一致, 不返回内核中全部CPU的掩码
+    OSALCpuSet getAffinity() const override {
+#if defined(__linux__)
+        if (threadHandle && affinity_ != 0) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            if (pthread_getaffinity_np(threadHandle, sizeof(cpus), &cpus) == 0) {
+                OSALCpuSet cpuSet = 0;
+                for (uint32_t cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &cpus)) cpuSet |= cpuSetOf(cpu);
+                }
+                return cpuSet;
+            }
+        }
+#endif
+        return affinity_;
+    }
+
 private:
+#if defined(__linux__)
+    // 0表示不限制, 即允许所有CPU
+    static cpu_set_t toCpuSet(OSALCpuSet cpuSet) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (cpuSet == 0 || (cpu < 64 && (cpuSet & cpuSetOf(cpu)) != 0)) {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+        return cpus;
+    }
+#endif
+
     static void *taskRunner(void *parameters) {
         // 设置取消类型为异步, 可以使线程在接收到取消请求时立即响应而无需等待取消点。
         pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, nullptr);
@@ -190,6 +255,7 @@ private:
     void *taskArgument;
     std::atomic<bool> running;
     std::atomic<bool> suspended;
+    OSALCpuSet affinity_ = 0;
     std::mutex mutex_;
     std::condition_variable cv_;
 };
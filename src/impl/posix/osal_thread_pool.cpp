@@ -24,62 +24,220 @@
 
 #include "osal_thread_pool.h"
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
+#include <thread>
 
+#include "osal_chrono.h"
 #include "osal_thread.h"
 
 namespace osal {
 
+namespace {
+// 当前线程所在的线程池及其本地队列下标, 工作线程内部提交的任务直接压入本地队列
+thread_local OSALThreadPool *tlsPool = nullptr;
+thread_local int tlsWorkerIndex = -1;
+thread_local OSALThreadPoolStatsRegistry::Shard *tlsStatsShard = nullptr;
+
+// 外部提交线程固定使用一个注入分片, 不同的提交线程分散到不同分片
+std::atomic<size_t> nextShardHint{0};
+thread_local size_t tlsShardHint = nextShardHint.fetch_add(1, std::memory_order_relaxed);
+
+// 线程退出任务循环时(包括被取消时)更新计数
+struct LiveThreadGuard {
+    explicit LiveThreadGuard(std::atomic<uint32_t> &counter) : counter_(counter) { ++counter_; }
+    ~LiveThreadGuard() { --counter_; }
+    std::atomic<uint32_t> &counter_;
+};
+
+// 工作线程在任务循环期间独占一个统计分片
+struct StatsShardGuard {
+    StatsShardGuard(OSALThreadPoolStatsRegistry &registry, uint64_t now)
+        : registry_(registry), shard(registry.acquire(now)) {}
+    ~StatsShardGuard() { registry_.release(shard); }
+    OSALThreadPoolStatsRegistry &registry_;
+    OSALThreadPoolStatsRegistry::Shard *shard;
+};
+}  // namespace
+
 OSALThreadPool::OSALThreadPool()
-    : isstarted_(false), suspended_(false), priority_(0), activeThreads_(0), maxThreads_(0), minThreads_(0) {}
+    : isstarted_(false),
+      suspended_(false),
+      priority_(0),
+      activeThreads_(0),
+      maxThreads_(0),
+      minThreads_(0),
+      mode_(SchedulingMode::SharedQueue),
+      pendingTasks_(0),
+      idleThreads_(0),
+      liveThreads_(0),
+      agingInterval_(0),
+      idleTimeout_(0),
+      growQueueDepth_(1),
+      growWaitTime_(0),
+      threadCount_(0),
+      retiredThreads_(0),
+      peakThreads_(0),
+      threadsCreated_(0),
+      threadsRetired_(0),
+      affinity_(0),
+      pinEach_(false),
+      affinityCursor_(0),
+      queueCapacity_(0),
+      overflowPolicy_(ThreadPoolOverflowPolicy::Block),
+      overflowTimeout_(0),
+      blockedSubmitters_(0),
+      spinCount_(0),
+      yieldCount_(0),
+      hotThreads_(0),
+      hotSpinners_(0),
+      submitEpoch_(0),
+      timers_(dispatchTimer, this) {}
 
 OSALThreadPool::~OSALThreadPool() { stop(); }
 
-void OSALThreadPool::start(uint32_t numThreads, int priority, int stack_size) {
+int OSALThreadPool::start(uint32_t numThreads, int priority, int stack_size) {
     stop();  // 停止任何现有的线程池
-    isstarted_ = true;
     minThreads_ = numThreads;
     maxThreads_ = numThreads;
     priority_ = priority;
     stack_size_ = stack_size;
+    if (mode_ == SchedulingMode::WorkStealing) {
+        // 本地队列数量取线程数与CPU核数的较大值, 为后续扩容的线程预留位置
+        uint32_t slots = std::max<uint32_t>(numThreads, std::thread::hardware_concurrency());
+        slots = std::max<uint32_t>(slots, 1);
+        workerDeques_.clear();
+        injectionShards_.clear();
+        for (uint32_t i = 0; i < slots; ++i) {
+            workerDeques_.push_back(std::make_unique<TaskDeque>());
+            injectionShards_.push_back(std::make_unique<InjectionShard>());
+        }
+        // 将启动前提交到共享队列中的任务迁移到注入队列
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        Task task;
+        for (size_t i = 0; taskQueue_.pop(task); ++i) {
+            InjectionShard &shard = *injectionShards_[i % slots];
+            pushReady(shard.tasks, std::move(task));
+            shard.count.fetch_add(1, std::memory_order_relaxed);
+            ++pendingTasks_;
+        }
+    }
+    peakThreads_ = 0;
+    threadsCreated_ = 0;
+    threadsRetired_ = 0;
+    stats_.reset(statsTimestamp());
+    isstarted_ = true;
     for (uint32_t i = 0; i < numThreads; ++i) {
         OSALThreadPool::OSALAddTread();
     }
-    OSAL_LOGD("Thread pool started with %u threads\n", numThreads);
+    if (numThreads > 0 && threadCount_ == 0) {
+        OSAL_LOGE("Failed to start thread pool: no worker thread could be created\n");
+        stop();
+        return -1;
+    }
+    timers_.start(priority, stack_size);
+    OSAL_LOGD("Thread pool started with %u/%u threads\n", static_cast<uint32_t>(threadCount_), numThreads);
+    return 0;
 }
 
 bool OSALThreadPool::OSALAddTread() {
+    std::lock_guard<std::mutex> lock(threadsMutex_);
+    if (isstarted_ && threadCount_ >= maxThreads_) {
+        return false;
+    }
     auto thread = std::make_unique<OSALThread>();
     if (thread == nullptr) {
         OSAL_LOGE("Failed to create thread\n");
         return false;
     } else {
-        thread->start("ThreadPool", threadEntry, this, priority_, stack_size_);
+        thread->setAffinity(nextWorkerAffinity());
+        if (thread->start("ThreadPool", threadEntry, this, priority_, stack_size_) != 0) {
+            OSAL_LOGE("Failed to start thread pool worker\n");
+            return false;
+        }
         threads_.push_back(std::move(thread));
+        uint32_t count = ++threadCount_;
+        ++threadsCreated_;
+        uint32_t peak = peakThreads_;
+        while (count > peak && !peakThreads_.compare_exchange_weak(peak, count)) {
+        }
         return true;
     }
 }
 
+// 回收一个已退出任务循环的线程, 释放其栈空间
 bool OSALThreadPool::OSALDelTread() {
-    bool result = false;
-    for (auto &thread : threads_) {
-        if (!thread->isRunning()) {
-            thread->stop();
-            threads_.erase(std::remove(threads_.begin(), threads_.end(), thread), threads_.end());
-            result = true;
-            break;
+    std::shared_ptr<OSALThread> retired;
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        auto it = std::find_if(threads_.begin(), threads_.end(),
+                               [](const std::shared_ptr<OSALThread> &thread) { return !thread->isRunning(); });
+        if (it == threads_.end()) {
+            return false;
         }
+        retired = std::move(*it);
+        threads_.erase(it);
     }
-    return result;
+    retired->join();
+    --retiredThreads_;
+    return true;
 }
 
 void OSALThreadPool::stop() {
     isstarted_ = false;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+    }
     condition_.notify_all();
-    for (std::shared_ptr<OSALThread> thread : threads_) {
-        thread->stop();
+    resumeCondition_.notify_all();
+    spaceCondition_.notify_all();  // 线程池停止后提交的任务直接进入共享队列, 不再等待空位
+    timers_.stop();                // 未到期的延时任务保留到下次启动
+    // 等待线程自行退出任务循环(包括刚执行完任务、正在析构任务闭包的线程), 避免异步取消落在析构函数中;
+    // 超时后仍在执行任务的线程被强制取消
+    for (int i = 0; i < 100 && liveThreads_ > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // 全部线程均已退出任务循环时直接回收, 不再取消, 避免异步取消落在线程退出路径上的析构函数中
+    bool exited = liveThreads_ == 0;
+    std::vector<std::shared_ptr<OSALThread>> threads;
+    {
+        std::lock_guard<std::mutex> lock(threadsMutex_);
+        threads.swap(threads_);
+    }
+    for (auto &thread : threads) {
+        if (exited || !thread->isRunning()) {
+            thread->join();
+        } else {
+            thread->stop();
+        }
+    }
+    threadCount_ = 0;
+    retiredThreads_ = 0;
+    activeThreads_ = 0;
+    idleThreads_ = 0;
+    liveThreads_ = 0;
+
+    // 工作窃取模式下未执行的任务放回共享队列, 保证getTaskQueueSize()及下次启动可见
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    for (auto &deque : workerDeques_) {
+        std::lock_guard<std::mutex> dequeLock(deque->mutex);
+        while (!deque->tasks.empty()) {
+            pushReady(taskQueue_, std::move(deque->tasks.front()));
+            deque->tasks.popFront();
+        }
+        deque->count = 0;
+        deque->owned = false;
+    }
+    for (auto &shard : injectionShards_) {
+        std::lock_guard<std::mutex> shardLock(shard->mutex);
+        Task task;
+        while (shard->tasks.pop(task)) {
+            pushReady(taskQueue_, std::move(task));
+        }
+        shard->count = 0;
     }
-    threads_.clear();
+    pendingTasks_ = 0;
     OSAL_LOGD("Thread pool stopped\n");
 }
 
@@ -91,7 +249,10 @@ int OSALThreadPool::suspend() {
 
 int OSALThreadPool::resume() {
     suspended_ = false;
-    condition_.notify_all();
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+    }
+    resumeCondition_.notify_all();
     OSAL_LOGD("Thread pool resumed\n");
     return 0;
 }
@@ -100,19 +261,300 @@ bool OSALThreadPool::isStarted() const { return isstarted_; }
 
 bool OSALThreadPool::isSuspended() const { return suspended_; }
 
-void OSALThreadPool::submit(std::function<void(void *)> taskFunction, void *taskArgument, int priority) {
+ThreadPoolSubmitStatus OSALThreadPool::submit(std::function<void(void *)> taskFunction, void *taskArgument,
+                                              int priority) {
+    // 普通函数指针直接存放, 不再包一层std::function
+    if (auto plain = taskFunction.target<void (*)(void *)>()) {
+        return enqueue(priority, *plain, taskArgument);
+    }
+    return enqueue(priority, std::move(taskFunction), taskArgument);
+}
+
+ThreadPoolSubmitStatus OSALThreadPool::submitBatch(std::span<Task> tasks) {
+    if (tasks.empty()) return ThreadPoolSubmitStatus::Accepted;
+    uint64_t submitted = statsTimestamp();
+    for (auto &task : tasks) {
+        task.submitTime = submitted;
+    }
+    bool grow = false;
+    ThreadPoolSubmitStatus status;
+    DroppedTasks dropped;  // 在队列锁释放后销毁
+    if (mode_ == SchedulingMode::WorkStealing && isstarted_) {
+        status = admitWorkStealing(tasks.size(), dropped);
+        if (status == ThreadPoolSubmitStatus::Accepted) {
+            uint32_t longestWait = pushWorkStealingBatch(tasks);
+            grow = shouldGrow(pendingTasks_, longestWait);
+        }
+    } else {
+        size_t wakeups = 0;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            status = admitLocked(lock, tasks.size(), dropped);
+            if (status != ThreadPoolSubmitStatus::Accepted) {
+                lock.unlock();
+                return overflowBatch(status, tasks);
+            }
+            uint32_t now = readyTimestamp();
+            for (auto &task : tasks) {
+                int priority = task.priority;
+                taskQueue_.push(std::move(task), priority, now);
+            }
+            submitEpoch_.fetch_add(1, std::memory_order_release);
+            wakeups = std::min<size_t>(tasks.size(), idleThreads_);
+            grow = wakeups < tasks.size() && shouldGrowLocked();
+        }
+        for (size_t i = 0; i < wakeups; ++i) {
+            condition_.notify_one();
+        }
+    }
+    if (status != ThreadPoolSubmitStatus::Accepted) {
+        return overflowBatch(status, tasks);
+    }
+    stats_.recordSubmit(tasks.size());
+    onTaskSubmitted(grow);
+    return ThreadPoolSubmitStatus::Accepted;
+}
+
+bool OSALThreadPool::runPendingTask() {
+    Task task;
+    if (mode_ == SchedulingMode::WorkStealing && isstarted_) {
+        if (suspended_ || !popWorkStealing(tlsPool == this ? tlsWorkerIndex : -1, task)) return false;
+        notifySpaceAvailable();
+    } else {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        if (suspended_ || !popReady(taskQueue_, task)) return false;
+        if (blockedSubmitters_ > 0) {
+            spaceCondition_.notify_all();
+        }
+    }
+    if (task.function == nullptr) {
+        if (taskFailureCallback_ != nullptr) {
+            taskFailureCallback_(task.argument);
+        }
+        return true;
+    }
+    // 工作线程使用自己的统计分片, 其他线程临时借用一个; 帮忙的线程不计入活跃线程数
+    bool borrowed = tlsPool != this;
+    OSALThreadPoolStatsRegistry::Shard *shard = borrowed ? stats_.acquire(statsTimestamp()) : tlsStatsShard;
+    uint64_t started = statsTimestamp();
+    task.function(task.argument);
+    stats_.recordTask(shard, task.submitTime, started, statsTimestamp());
+    if (borrowed) stats_.release(shard);
+    return true;
+}
+
+ThreadPoolSubmitStatus OSALThreadPool::overflowBatch(ThreadPoolSubmitStatus status, std::span<Task> tasks) {
+    if (status == ThreadPoolSubmitStatus::RanInCaller) {
+        for (auto &task : tasks) {
+            if (task.function != nullptr) {
+                task.function(task.argument);
+            }
+        }
+        stats_.recordRanInCaller(tasks.size());
+    } else {
+        stats_.recordRejected(tasks.size());
+    }
+    return status;
+}
+
+ThreadPoolSubmitStatus OSALThreadPool::admitLocked(std::unique_lock<std::mutex> &lock, size_t count,
+                                                   DroppedTasks &dropped) {
+    size_t capacity = queueCapacity_;
+    if (capacity == 0 || queuedTasksLocked() + count <= capacity) {
+        return ThreadPoolSubmitStatus::Accepted;
+    }
+    switch (overflowPolicy_.load()) {
+        case ThreadPoolOverflowPolicy::Reject:
+            return ThreadPoolSubmitStatus::Rejected;
+        case ThreadPoolOverflowPolicy::CallerRuns:
+            return ThreadPoolSubmitStatus::RanInCaller;
+        case ThreadPoolOverflowPolicy::DropOldest: {
+            size_t excess = queuedTasksLocked() + count - capacity;
+            size_t first = dropped.size();
+            while (dropped.size() - first < excess && dropOldestLocked(dropped)) {
+            }
+            size_t evicted = dropped.size() - first;
+            stats_.recordDropped(evicted);
+            // 排队的任务正被其他线程取走、暂时无法丢弃时拒绝, 不让队列超出容量
+            if (evicted < excess && queuedTasksLocked() > 0) {
+                return ThreadPoolSubmitStatus::Rejected;
+            }
+            return ThreadPoolSubmitStatus::Accepted;
+        }
+        case ThreadPoolOverflowPolicy::Block:
+        default:
+            break;
+    }
+    // 工作线程等待自己所在线程池的空位可能导致所有线程互相等待, 改为在当前线程执行
+    if (tlsPool == this) {
+        return ThreadPoolSubmitStatus::RanInCaller;
+    }
+    // 批量大于容量时等待队列清空, 否则永远等不到足够的空位
+    auto hasSpace = [this, count] {
+        size_t queued = queuedTasksLocked();
+        size_t limit = queueCapacity_;
+        return !isstarted_ || limit == 0 || queued + count <= limit || queued == 0;
+    };
+    uint32_t timeout = overflowTimeout_;
+    ++blockedSubmitters_;
+    bool admitted = true;
+    if (timeout == 0) {
+        spaceCondition_.wait(lock, hasSpace);
+    } else {
+        admitted = spaceCondition_.wait_for(lock, std::chrono::milliseconds(timeout), hasSpace);
+    }
+    --blockedSubmitters_;
+    return admitted ? ThreadPoolSubmitStatus::Accepted : ThreadPoolSubmitStatus::Timeout;
+}
+
+// 工作窃取模式下排队数与入队不在同一把锁内, 并发提交时队列长度可能短暂超出容量, 超出量不超过并发提交的线程数
+ThreadPoolSubmitStatus OSALThreadPool::admitWorkStealing(size_t count, DroppedTasks &dropped) {
+    size_t capacity = queueCapacity_;
+    if (capacity == 0 || pendingTasks_ + count <= capacity) {
+        return ThreadPoolSubmitStatus::Accepted;
+    }
+    std::unique_lock<std::mutex> lock(queueMutex_);
+    return admitLocked(lock, count, dropped);
+}
+
+size_t OSALThreadPool::queuedTasksLocked() const {
+    return mode_ == SchedulingMode::WorkStealing && isstarted_ ? pendingTasks_.load() : taskQueue_.size();
+}
+
+// 调用方持有queueMutex_; 把最低优先级中最早入队的任务移入dropped, 由提交方在释放队列锁后销毁
+// 工作窃取模式下先从注入队列中丢弃, 注入队列为空时丢弃工作线程本地队列头部(最早入队)的任务
+bool OSALThreadPool::dropOldestLocked(DroppedTasks &dropped) {
+    Task task;
+    if (!(mode_ == SchedulingMode::WorkStealing && isstarted_)) {
+        if (!taskQueue_.popLowest(task)) return false;
+        dropped.push_back(std::move(task));
+        return true;
+    }
+    for (auto &shard : injectionShards_) {
+        if (shard->count.load(std::memory_order_relaxed) == 0) continue;
+        std::lock_guard<std::mutex> shardLock(shard->mutex);
+        if (shard->tasks.popLowest(task)) {
+            dropped.push_back(std::move(task));
+            shard->count.fetch_sub(1, std::memory_order_relaxed);
+            --pendingTasks_;
+            return true;
+        }
+    }
+    for (auto &deque : workerDeques_) {
+        if (deque->count.load(std::memory_order_relaxed) == 0) continue;
+        std::lock_guard<std::mutex> dequeLock(deque->mutex);
+        if (!deque->tasks.empty()) {
+            dropped.push_back(std::move(deque->tasks.front()));
+            deque->tasks.popFront();
+            deque->count.fetch_sub(1, std::memory_order_relaxed);
+            --pendingTasks_;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 工作线程取走任务后调用, 没有被阻塞的提交线程时只读一次原子变量
+void OSALThreadPool::notifySpaceAvailable() {
+    if (blockedSubmitters_ == 0) return;
     {
         std::lock_guard<std::mutex> lock(queueMutex_);
-        taskQueue_.emplace(Task{taskFunction, taskArgument, priority});
     }
-    condition_.notify_one();
-    // 如果当前仍有任务堆积, 且已有线程池跑满，且未达到最大线程值
-    if (activeThreads_ == std::size(threads_) && activeThreads_ < maxThreads_) {
-        OSALAddTread();
+    spaceCondition_.notify_all();
+}
+
+void OSALThreadPool::onTaskSubmitted(bool grow) {
+    reapRetiredWorkers();
+    if (grow && OSALAddTread()) {
+        OSAL_LOGD("Thread pool grown to %u threads\n", threadCount_.load());
     }
     OSAL_LOGD("Task submitted\n");
 }
 
+bool OSALThreadPool::shouldGrow(size_t queueDepth, uint32_t longestWait) const {
+    // 空闲线程足以接走排队任务或已达到最大线程数时不扩容;
+    // 已被唤醒但尚未取走任务的线程仍计为空闲, 因此按排队数减空闲数计算积压
+    size_t idle = idleThreads_;
+    if (!isstarted_ || threadCount_ >= maxThreads_ || queueDepth <= idle) {
+        return false;
+    }
+    uint32_t waitTime = growWaitTime_;
+    return queueDepth - idle >= growQueueDepth_ || (waitTime > 0 && longestWait >= waitTime);
+}
+
+bool OSALThreadPool::shouldGrowLocked() const {
+    uint32_t longestWait = growWaitTime_ > 0 ? taskQueue_.longestWait(OSALChrono::getInstance().now()) : 0;
+    return shouldGrow(taskQueue_.size(), longestWait);
+}
+
+bool OSALThreadPool::waitForTask(std::unique_lock<std::mutex> &lock) {
+    auto ready = [this] { return !taskQueue_.empty() || !isstarted_; };
+    uint32_t timeout = idleTimeout_;
+    if (timeout == 0) {
+        condition_.wait(lock, ready);
+        return true;
+    }
+    return condition_.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+}
+
+// 暂停期间工作线程停在恢复闸门上, 新提交的任务只入队、不会把线程唤醒空转, resume()一次广播全部放行
+void OSALThreadPool::waitForResume(std::unique_lock<std::mutex> &lock) {
+    resumeCondition_.wait(lock, [this] { return !suspended_ || !isstarted_; });
+}
+
+// 空闲超时的线程在线程数高于最小线程数时退出; 已退出的线程由其余线程空闲超时或退出时回收, 也由提交和stop()回收
+bool OSALThreadPool::retireIdleWorker() {
+    uint32_t count = threadCount_;
+    while (count > minThreads_) {
+        if (threadCount_.compare_exchange_weak(count, count - 1)) {
+            ++retiredThreads_;
+            ++threadsRetired_;
+            OSAL_LOGD("Idle thread retired, %u threads left\n", count - 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void OSALThreadPool::reapRetiredWorkers() {
+    while (retiredThreads_ > 0 && OSALDelTread()) {
+    }
+}
+
+bool OSALThreadPool::isSpinEnabled() const { return spinCount_ > 0 || yieldCount_ > 0 || hotThreads_ > 0; }
+
+bool OSALThreadPool::claimHotThread() {
+    uint32_t spinners = hotSpinners_;
+    while (spinners < hotThreads_) {
+        if (hotSpinners_.compare_exchange_weak(spinners, spinners + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 空闲线程休眠前的自旋阶段, 不持有队列锁, ready()为true时返回true;
+// 热线程一直自旋, 直到有新任务或线程池停止、暂停, 每轮自旋后让出一次CPU, 避免饿死同核的其他线程
+template <typename Ready>
+bool OSALThreadPool::spinForTask(Ready &&ready) {
+    bool hot = claimHotThread();
+    OSALSpinWait wait(spinCount_, yieldCount_);
+    bool found = false;
+    while (isstarted_ && !suspended_) {
+        if (ready()) {
+            found = true;
+            break;
+        }
+        if (!wait.spinOnce()) {
+            if (!hot) break;
+            OSALSystem::getInstance().yield();
+            wait.reset();
+        }
+    }
+    if (hot) --hotSpinners_;
+    return found;
+}
+
 void OSALThreadPool::setPriority(int priority) {
     priority_ = priority;
     for (std::shared_ptr<OSALThread> thread : threads_) {
@@ -126,28 +568,19 @@ int OSALThreadPool::getPriority() const { return priority_; }
 
 size_t OSALThreadPool::getTaskQueueSize() {
     std::lock_guard<std::mutex> lock(queueMutex_);
-    return taskQueue_.size();
+    return taskQueue_.size() + pendingTasks_;
 }
 
 uint32_t OSALThreadPool::getActiveThreadCount() const { return activeThreads_; }
 
 bool OSALThreadPool::cancelTask(std::function<void(void *)> &taskFunction) {
     std::lock_guard<std::mutex> lock(queueMutex_);
-    std::queue<Task> newQueue;
-    bool found = false;
     auto targetPtr = taskFunction.template target<void (*)(void *)>();
-    while (!taskQueue_.empty()) {
-        Task task = taskQueue_.front();
-        taskQueue_.pop();
+    bool found = taskQueue_.removeIf([targetPtr](const Task &task) {
         auto taskPtr = task.function.template target<void (*)(void *)>();
         // (!taskPtr && !targetPtr) 判断是为了处理两个空的 std::function 对象相等的情况。
-        if ((taskPtr && targetPtr && *taskPtr == *targetPtr) || (!taskPtr && !targetPtr)) {
-            found = true;
-        } else {
-            newQueue.push(task);
-        }
-    }
-    taskQueue_ = std::move(newQueue);
+        return (taskPtr && targetPtr && *taskPtr == *targetPtr) || (!taskPtr && !targetPtr);
+    }) > 0;
     OSAL_LOGD("Task %s\n", found ? "cancelled" : "not found");
     return found;
 }
@@ -164,6 +597,19 @@ void OSALThreadPool::setMaxThreads(uint32_t maxThreads) {
 
 uint32_t OSALThreadPool::getMaxThreads() const { return maxThreads_; }
 
+void OSALThreadPool::setQueueCapacity(size_t capacity, ThreadPoolOverflowPolicy policy, uint32_t timeout) {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        queueCapacity_ = capacity;
+        overflowPolicy_ = policy;
+        overflowTimeout_ = timeout;
+    }
+    spaceCondition_.notify_all();
+    OSAL_LOGD("Queue capacity set to %zu, overflow policy %d\n", capacity, static_cast<int>(policy));
+}
+
+size_t OSALThreadPool::getQueueCapacity() const { return queueCapacity_; }
+
 void OSALThreadPool::setMinThreads(uint32_t minThreads) {
     minThreads_ = minThreads;
     OSAL_LOGD("Min threads set to %u\n", minThreads);
@@ -171,32 +617,360 @@ void OSALThreadPool::setMinThreads(uint32_t minThreads) {
 
 uint32_t OSALThreadPool::getMinThreads() const { return minThreads_; }
 
+void OSALThreadPool::setPriorityAging(uint32_t interval) {
+    agingInterval_ = interval;
+    OSAL_LOGD("Priority aging interval set to %u ms\n", interval);
+}
+
+uint32_t OSALThreadPool::getPriorityAging() const { return agingInterval_; }
+
+void OSALThreadPool::setIdleTimeout(uint32_t timeout) {
+    idleTimeout_ = timeout;
+    OSAL_LOGD("Idle timeout set to %u ms\n", timeout);
+}
+
+uint32_t OSALThreadPool::getIdleTimeout() const { return idleTimeout_; }
+
+void OSALThreadPool::setGrowThreshold(size_t queueDepth, uint32_t waitTime) {
+    growQueueDepth_ = queueDepth > 0 ? queueDepth : 1;
+    growWaitTime_ = waitTime;
+    OSAL_LOGD("Grow threshold set to %zu tasks or %u ms\n", queueDepth, waitTime);
+}
+
+ThreadPoolScalingStats OSALThreadPool::getScalingStats() const {
+    return ThreadPoolScalingStats{threadCount_, peakThreads_, threadsCreated_, threadsRetired_};
+}
+
+ThreadPoolStats OSALThreadPool::getStats() const { return stats_.snapshot(statsTimestamp()); }
+
+void OSALThreadPool::resetStats() {
+    stats_.reset(statsTimestamp());
+    OSAL_LOGD("Thread pool stats reset\n");
+}
+
+void OSALThreadPool::setAffinity(OSALCpuSet cpuSet, bool pinEach) {
+    std::lock_guard<std::mutex> lock(threadsMutex_);
+    affinity_ = cpuSet;
+    pinEach_ = pinEach;
+    affinityCursor_ = 0;
+    for (auto &thread : threads_) {
+        thread->setAffinity(nextWorkerAffinity());
+    }
+    OSAL_LOGD("Thread pool affinity set to 0x%llx%s\n", static_cast<unsigned long long>(cpuSet),
+              pinEach ? " (pinned)" : "");
+}
+
+OSALCpuSet OSALThreadPool::getAffinity() const { return affinity_; }
+
+void OSALThreadPool::setSpinPolicy(const ThreadPoolSpinPolicy &policy) {
+    spinCount_ = policy.spinCount;
+    yieldCount_ = policy.yieldCount;
+    hotThreads_ = policy.hotThreads;
+    OSAL_LOGD("Spin policy set to %u spins, %u yields, %u hot threads\n", policy.spinCount, policy.yieldCount,
+              policy.hotThreads);
+}
+
+ThreadPoolSpinPolicy OSALThreadPool::getSpinPolicy() const {
+    return ThreadPoolSpinPolicy{spinCount_, yieldCount_, hotThreads_};
+}
+
+// 调用方持有threadsMutex_
+OSALCpuSet OSALThreadPool::nextWorkerAffinity() {
+    OSALCpuSet cpuSet = affinity_;
+    if (cpuSet == 0 || !pinEach_) {
+        return cpuSet;
+    }
+    return cpuSetOf(cpuSetNth(cpuSet, affinityCursor_++));
+}
+
+uint64_t OSALThreadPool::statsTimestamp() {
+#if OSAL_CONFIG_THREAD_POOL_STATS
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#else
+    return 0;
+#endif
+}
+
+void OSALThreadPool::setSchedulingMode(SchedulingMode mode) {
+    if (isstarted_) {
+        OSAL_LOGE("Scheduling mode can only be changed before start\n");
+        return;
+    }
+    mode_ = mode;
+    OSAL_LOGD("Scheduling mode set to %d\n", static_cast<int>(mode));
+}
+
+OSALThreadPool::SchedulingMode OSALThreadPool::getSchedulingMode() const { return mode_; }
+
 void OSALThreadPool::threadEntry(void *arg) {
     OSALThreadPool *pool = static_cast<OSALThreadPool *>(arg);
     pool->threadLoop();
 }
 
 void OSALThreadPool::threadLoop() {
+    LiveThreadGuard guard(liveThreads_);
+    StatsShardGuard stats(stats_, statsTimestamp());
+    tlsPool = this;
+    tlsStatsShard = stats.shard;
+    if (mode_ == SchedulingMode::WorkStealing) {
+        workStealingLoop(stats.shard);
+        if (isstarted_) reapRetiredWorkers();  // 空闲退出时回收此前退出的线程
+        tlsPool = nullptr;
+        return;
+    }
+    uint64_t clock = 0;
     while (isstarted_) {
         Task task;
         {
             std::unique_lock<std::mutex> lock(queueMutex_);
-            condition_.wait(lock, [this] { return !taskQueue_.empty() || !isstarted_; });
+            if (suspended_) {
+                waitForResume(lock);
+                clock = 0;
+                continue;
+            }
+            if (taskQueue_.empty() && !suspended_ && isSpinEnabled()) {
+                // 先不休眠, 释放锁自旋等待入队计数变化, 省去提交方的唤醒和线程调度延迟
+                uint32_t epoch = submitEpoch_;
+                lock.unlock();
+                spinForTask([this, epoch] { return submitEpoch_.load(std::memory_order_acquire) != epoch; });
+                lock.lock();
+                clock = 0;
+            }
+            if (taskQueue_.empty() || suspended_) clock = 0;
+            ++idleThreads_;
+            bool ready = waitForTask(lock);
+            --idleThreads_;
             if (!isstarted_) break;
+            if (!ready) {
+                if (retireIdleWorker()) break;
+                lock.unlock();
+                reapRetiredWorkers();
+                continue;
+            }
             if (suspended_) continue;
-            task = taskQueue_.front();
-            taskQueue_.pop();
+            popReady(taskQueue_, task);
+            if (blockedSubmitters_ > 0) {
+                spaceCondition_.notify_all();
+            }
+        }
+        runTask(task, stats.shard, clock);
+    }
+    if (isstarted_) reapRetiredWorkers();  // 空闲退出时回收此前退出的线程
+    tlsPool = nullptr;
+}
+
+uint32_t OSALThreadPool::readyTimestamp() const {
+    return agingInterval_ > 0 || growWaitTime_ > 0 ? OSALChrono::getInstance().now() : 0;
+}
+
+void OSALThreadPool::pushReady(OSALPriorityBucketQueue<Task> &queue, Task &&task) {
+    int priority = task.priority;
+    queue.push(std::move(task), priority, readyTimestamp());
+}
+
+bool OSALThreadPool::popReady(OSALPriorityBucketQueue<Task> &queue, Task &task) {
+    uint32_t interval = agingInterval_;
+    return queue.pop(task, interval > 0 ? OSALChrono::getInstance().now() : 0, interval);
+}
+
+// clock为上一个任务的完成时间, 线程没有休眠、连续取到任务时直接作为本任务的开始时间, 每个任务少读一次时钟
+void OSALThreadPool::runTask(Task &task, OSALThreadPoolStatsRegistry::Shard *shard, uint64_t &clock) {
+    if (task.function != nullptr) {
+        ++activeThreads_;
+        uint64_t started = clock != 0 ? std::max(clock, task.submitTime) : statsTimestamp();
+        task.function(task.argument);
+        clock = statsTimestamp();
+        stats_.recordTask(shard, task.submitTime, started, clock);
+        --activeThreads_;
+    } else {
+        if (taskFailureCallback_ != nullptr) {
+            taskFailureCallback_(task.argument);
+        }
+    }
+}
+
+void OSALThreadPool::workStealingLoop(OSALThreadPoolStatsRegistry::Shard *shard) {
+    int self = claimWorkerDeque();
+    tlsWorkerIndex = self;
+    uint64_t clock = 0;
+    while (isstarted_) {
+        if (suspended_) {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            waitForResume(lock);
+            clock = 0;
+            continue;
+        }
+        Task task;
+        if (popWorkStealing(self, task)) {
+            notifySpaceAvailable();
+            runTask(task, shard, clock);
+            continue;
         }
-        if (task.function != nullptr) {
-            ++activeThreads_;
-            task.function(task.argument);
-            --activeThreads_;
+        clock = 0;
+        if (isSpinEnabled() && spinForTask([this] { return pendingTasks_ > 0; })) continue;
+        // 所有队列均为空, 休眠等待新任务; idleThreads_与pendingTasks_的先写后读保证提交方不会漏掉唤醒
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        auto ready = [this] { return pendingTasks_ > 0 || suspended_ || !isstarted_; };
+        uint32_t timeout = idleTimeout_;
+        ++idleThreads_;
+        bool woken = true;
+        if (timeout == 0) {
+            condition_.wait(lock, ready);
         } else {
-            if (taskFailureCallback_ != nullptr) {
-                taskFailureCallback_(task.argument);
+            woken = condition_.wait_for(lock, std::chrono::milliseconds(timeout), ready);
+        }
+        --idleThreads_;
+        if (!woken) {
+            if (retireIdleWorker()) break;
+            lock.unlock();
+            reapRetiredWorkers();
+        }
+    }
+    tlsWorkerIndex = -1;
+    releaseWorkerDeque(self);
+}
+
+uint32_t OSALThreadPool::pushWorkStealing(Task &&task) {
+    uint32_t longestWait = 0;
+    if (tlsPool == this && tlsWorkerIndex >= 0) {
+        // 工作线程内部提交: 压入自己的本地队列
+        TaskDeque &local = *workerDeques_[tlsWorkerIndex];
+        std::lock_guard<std::mutex> lock(local.mutex);
+        local.tasks.pushBack(std::move(task));
+        local.count.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        InjectionShard &shard = *injectionShards_[tlsShardHint % injectionShards_.size()];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        pushReady(shard.tasks, std::move(task));
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+        longestWait = shardLongestWait(shard);
+    }
+    ++pendingTasks_;
+    if (idleThreads_ > 0) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+        }
+        condition_.notify_one();
+    }
+    return longestWait;
+}
+
+uint32_t OSALThreadPool::pushWorkStealingBatch(std::span<Task> tasks) {
+    uint32_t longestWait = 0;
+    if (tlsPool == this && tlsWorkerIndex >= 0) {
+        TaskDeque &local = *workerDeques_[tlsWorkerIndex];
+        std::lock_guard<std::mutex> lock(local.mutex);
+        for (auto &task : tasks) {
+            local.tasks.pushBack(std::move(task));
+        }
+        local.count.fetch_add(tasks.size(), std::memory_order_relaxed);
+    } else {
+        InjectionShard &shard = *injectionShards_[tlsShardHint % injectionShards_.size()];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        uint32_t now = readyTimestamp();
+        for (auto &task : tasks) {
+            int priority = task.priority;
+            shard.tasks.push(std::move(task), priority, now);
+        }
+        shard.count.fetch_add(tasks.size(), std::memory_order_relaxed);
+        longestWait = shardLongestWait(shard);
+    }
+    pendingTasks_ += tasks.size();
+    size_t wakeups = std::min<size_t>(tasks.size(), idleThreads_);
+    if (wakeups > 0) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+        }
+        for (size_t i = 0; i < wakeups; ++i) {
+            condition_.notify_one();
+        }
+    }
+    return longestWait;
+}
+
+// 调用方持有shard.mutex
+uint32_t OSALThreadPool::shardLongestWait(const InjectionShard &shard) const {
+    return growWaitTime_ > 0 ? shard.tasks.longestWait(OSALChrono::getInstance().now()) : 0;
+}
+
+bool OSALThreadPool::popWorkStealing(int self, Task &task) {
+    // 1. 从本地队列尾部弹出最近提交的任务, 数据仍在缓存中
+    if (self >= 0) {
+        TaskDeque &local = *workerDeques_[self];
+        if (local.count.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(local.mutex);
+            if (!local.tasks.empty()) {
+                task = std::move(local.tasks.back());
+                local.tasks.popBack();
+                local.count.fetch_sub(1, std::memory_order_relaxed);
+                --pendingTasks_;
+                return true;
             }
         }
     }
+
+    // 2. 从注入队列获取外部提交的任务, 优先检查自己对应的分片
+    size_t shards = injectionShards_.size();
+    size_t first = self >= 0 ? static_cast<size_t>(self) : tlsShardHint;
+    for (size_t i = 0; i < shards; ++i) {
+        InjectionShard &shard = *injectionShards_[(first + i) % shards];
+        if (shard.count.load(std::memory_order_relaxed) == 0) continue;
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (popReady(shard.tasks, task)) {
+            shard.count.fetch_sub(1, std::memory_order_relaxed);
+            --pendingTasks_;
+            return true;
+        }
+    }
+
+    // 3. 从其他线程本地队列的头部窃取最早提交的任务, 与所有者在两端操作
+    size_t victims = workerDeques_.size();
+    first = (self >= 0 ? static_cast<size_t>(self) : 0) + 1;
+    for (size_t i = 0; i < victims; ++i) {
+        size_t index = (first + i) % victims;
+        if (static_cast<int>(index) == self) continue;
+        TaskDeque &victim = *workerDeques_[index];
+        if (victim.count.load(std::memory_order_relaxed) == 0) continue;
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (lock.owns_lock() && !victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.popFront();
+            victim.count.fetch_sub(1, std::memory_order_relaxed);
+            --pendingTasks_;
+            return true;
+        }
+    }
+    return false;
+}
+
+int OSALThreadPool::claimWorkerDeque() {
+    for (size_t i = 0; i < workerDeques_.size(); ++i) {
+        bool expected = false;
+        if (workerDeques_[i]->owned.compare_exchange_strong(expected, true)) {
+            return static_cast<int>(i);
+        }
+    }
+    // 本地队列已全部占用, 该线程只从注入队列获取和窃取任务
+    return -1;
+}
+
+void OSALThreadPool::releaseWorkerDeque(int index) {
+    if (index < 0) return;
+    TaskDeque &local = *workerDeques_[index];
+    InjectionShard &shard = *injectionShards_[index % injectionShards_.size()];
+    {
+        // 将尚未执行的本地任务移交给注入队列, 由其他线程继续执行
+        std::scoped_lock lock(local.mutex, shard.mutex);
+        shard.count.fetch_add(local.tasks.size(), std::memory_order_relaxed);
+        while (!local.tasks.empty()) {
+            pushReady(shard.tasks, std::move(local.tasks.front()));
+            local.tasks.popFront();
+        }
+        local.count = 0;
+    }
+    local.owned = false;
 }
 
-}  // namespace osal
\ No newline at end of file
+}  // namespace osal
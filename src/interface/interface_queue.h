@@ -25,15 +25,55 @@
 #ifndef IQUEUE_H_
 #define IQUEUE_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "osal.h"
+
+#ifndef OSAL_CONFIG_MESSAGE_QUEUE_PRIORITY_LEVELS
+#define OSAL_CONFIG_MESSAGE_QUEUE_PRIORITY_LEVELS 4  // 消息优先级级数, 最大32
+#endif
+
 namespace osal {
 
+// 接收接口把消息移出队列, 不再额外拷贝
 template <typename T>
 class MessageQueue {
 public:
+    static constexpr uint8_t kPriorityLevels = OSAL_CONFIG_MESSAGE_QUEUE_PRIORITY_LEVELS;
+    static_assert(kPriorityLevels > 0 && kPriorityLevels <= 32, "priority levels must be in [1, 32]");
+
+    // 超出范围的优先级被限制到[0, kPriorityLevels - 1]
+    static constexpr uint8_t priorityLevel(uint8_t priority) {
+        return priority < kPriorityLevels ? priority : kPriorityLevels - 1;
+    }
+
     virtual ~MessageQueue() = default;
 
     virtual void send(const T &message) = 0;
 
+    virtual void send(T &&message) = 0;  // 移动发送, 避免拷贝消息持有的资源
+
+    // 按优先级发送: 接收时先取优先级数值最大的消息, 同一优先级内先进先出; 不带优先级的send等同于优先级0
+    // 默认忽略优先级按到达顺序发送, 供只能先进先出的实现(如无锁队列)使用
+    virtual void send(const T &message, uint8_t priority) {
+        (void)priority;
+        send(message);
+    }
+
+    virtual void send(T &&message, uint8_t priority) {
+        (void)priority;
+        send(std::move(message));
+    }
+
+    // 用参数构造消息后发送; 这里先构造临时对象再移动发送, 各实现可隐藏此函数, 直接在队列存储中构造
+    template <typename... Args>
+    void emplace(Args &&...args) {
+        send(T(std::forward<Args>(args)...));
+    }
+
     virtual T receive() = 0;
 
     virtual bool tryReceive(T &message) = 0;
@@ -41,6 +81,32 @@ public:
     virtual bool receiveFor(T &message, uint32_t timeout) = 0;  // 带超时的接收
     [[nodiscard]] virtual size_t size() const = 0;              // 获取队列大小
     virtual void clear() = 0;                                   // 清空队列
+
+    // 批量发送与接收: 默认逐条调用单条接口, 加锁的实现应覆盖为每批只加锁和通知一次
+
+    // 按顺序发送messages中的全部消息
+    virtual void sendBatch(std::span<const T> messages) {
+        for (const T &message : messages) {
+            send(message);
+        }
+    }
+
+    // 不等待, 取出最多maxCount条已排队的消息存入out, 返回取出的条数
+    virtual size_t receiveBatch(T *out, size_t maxCount) {
+        size_t count = 0;
+        while (count < maxCount && tryReceive(out[count])) {
+            ++count;
+        }
+        return count;
+    }
+
+    // 最多等待timeout毫秒直到有消息, 之后取出最多maxCount条存入out, 返回取出的条数, 超时返回0
+    virtual size_t receiveBatchFor(T *out, size_t maxCount, uint32_t timeout) {
+        if (maxCount == 0 || !receiveFor(out[0], timeout)) {
+            return 0;
+        }
+        return 1 + receiveBatch(out + 1, maxCount - 1);
+    }
 };
 
 }  // namespace osal
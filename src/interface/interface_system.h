@@ -37,6 +37,9 @@ public:
     // 休眠指定的时间
     virtual void sleep(uint32_t seconds) const = 0;
 
+    // 让出CPU, 调度同优先级的其他就绪线程
+    virtual void yield() const = 0;
+
     // 获取系统信息
     virtual const char *get_system_info() const = 0;
 };
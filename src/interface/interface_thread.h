@@ -25,6 +25,8 @@
 #ifndef ITHREAD_H_
 #define ITHREAD_H_
 
+#include "osal_cpu_set.h"
+
 namespace osal {
 
 class IThread {
@@ -58,6 +60,13 @@ public:
 
     // 获取线程优先级
     [[nodiscard]] virtual int getPriority() const = 0;
+
+    // 设置线程的CPU亲和性, cpuSet为CPU位掩码, 0表示不限制; 线程未启动时在下一次start()时生效
+    // 返回0表示成功, 平台不支持时返回-1(仍记录该设置)
+    virtual int setAffinity(OSALCpuSet cpuSet) = 0;
+
+    // 获取线程的CPU亲和性, 不限制时返回0
+    [[nodiscard]] virtual OSALCpuSet getAffinity() const = 0;
 };
 
 }  // namespace osal
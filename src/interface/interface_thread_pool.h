@@ -25,22 +25,62 @@
 #ifndef ITHREAD_POOL_H_
 #define ITHREAD_POOL_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "osal_cpu_set.h"
+#include "osal_thread_pool_stats.h"
+
 namespace osal {
 
+// 线程池弹性伸缩统计, 用于调整扩容阈值和空闲超时
+struct ThreadPoolScalingStats {
+    uint32_t currentThreads;  // 当前线程数(不含已退出等待回收的线程)
+    uint32_t peakThreads;     // 启动以来的最大线程数
+    uint32_t threadsCreated;  // 累计创建的线程数, 含启动时创建的线程
+    uint32_t threadsRetired;  // 因空闲超时退出的线程数
+};
+
+// 任务队列已满时的处理策略
+enum class ThreadPoolOverflowPolicy {
+    Block,       // 阻塞提交线程直到队列有空位, 可设置超时
+    Reject,      // 直接拒绝, 提交返回Rejected
+    CallerRuns,  // 在提交线程中直接执行该任务, 自然降低提交速度
+    DropOldest,  // 丢弃最低优先级中最早入队的任务, 为新任务腾出空位
+};
+
+// 提交结果
+enum class ThreadPoolSubmitStatus {
+    Accepted,     // 已进入任务队列
+    RanInCaller,  // 队列已满, 已在提交线程中执行完毕
+    Rejected,     // 队列已满, 任务被拒绝
+    Timeout,      // 队列已满, 等待空位超时, 任务被拒绝
+};
+
+// 空闲工作线程的等待策略: 先自旋轮询spinCount次(每次一条CPU pause指令), 再让出CPU yieldCount次, 之后休眠等待唤醒;
+// 另有hotThreads个空闲线程始终自旋不休眠("热"线程), 以占用CPU换取最低的派发延迟; 全部为0(默认)时空闲线程直接休眠
+struct ThreadPoolSpinPolicy {
+    uint32_t spinCount = 0;
+    uint32_t yieldCount = 0;
+    uint32_t hotThreads = 0;
+};
+
 class IThreadPool {
 public:
     virtual ~IThreadPool() = default;
 
-    // 启动线程池
-    virtual void start(uint32_t numThreads, int priority = 0, int stack_size = 0) = 0;
+    // 启动线程池, 成功返回0; 一个工作线程都无法创建时(如亲和性只包含离线CPU)停止线程池并返回-1,
+    // 部分线程创建失败时以实际创建的线程数运行, 可通过getScalingStats().currentThreads查询
+    virtual int start(uint32_t numThreads, int priority = 0, int stack_size = 0) = 0;
 
     // 停止线程池
     virtual void stop() = 0;
 
-    // 暂停线程池
+    // 暂停线程池: 正在执行的任务继续执行完, 工作线程随后休眠, 期间提交的任务在队列中积累
     virtual int suspend() = 0;
 
-    // 恢复线程池
+    // 恢复线程池, 一次唤醒所有暂停中的工作线程
     virtual int resume() = 0;
 
     // 检查线程池是否已经启动
@@ -49,8 +89,17 @@ public:
     // 检查线程池是否已暂停
     [[nodiscard]] virtual bool isSuspended() const = 0;
 
-    // 提交任务到线程池
-    virtual void submit(std::function<void(void *)> taskFunction, void *taskArgument, int priority) = 0;
+    // 提交任务到线程池, priority数值越大越先执行; 设置了队列容量时按溢出策略处理并返回结果
+    virtual ThreadPoolSubmitStatus submit(std::function<void(void *)> taskFunction, void *taskArgument,
+                                          int priority) = 0;
+
+    // 设置任务队列容量及队列满时的溢出策略, capacity为0表示不限制(默认)
+    // timeout仅用于Block策略, 为等待空位的最长时间(ms), 0表示一直等待;
+    // 工作线程向所在线程池提交时不阻塞, 按CallerRuns处理
+    virtual void setQueueCapacity(size_t capacity, ThreadPoolOverflowPolicy policy, uint32_t timeout = 0) = 0;
+
+    // 获取任务队列容量, 0表示不限制
+    [[nodiscard]] virtual size_t getQueueCapacity() const = 0;
 
     // 设置线程优先级
     virtual void setPriority(int priority) = 0;
@@ -64,7 +113,7 @@ public:
     // 获取当前活跃线程数
     [[nodiscard]] virtual uint32_t getActiveThreadCount() const = 0;
 
-    // 取消任务
+    // 取消任务: 按函数指针在队列中查找并删除, O(n)且持有队列锁; 需要精确取消某次提交时使用submitCancellable()返回的句柄
     virtual bool cancelTask(std::function<void(void *)> &taskFunction) = 0;
 
     // 设置任务执行失败时的回调
@@ -81,6 +130,45 @@ public:
 
     // 获取线程池的最小线程数
     [[nodiscard]] virtual uint32_t getMinThreads() const = 0;
+
+    // 设置任务优先级老化间隔(ms), 排队任务每等待一个间隔提升一级优先级, 0表示不启用
+    virtual void setPriorityAging(uint32_t interval) = 0;
+
+    // 获取任务优先级老化间隔(ms)
+    [[nodiscard]] virtual uint32_t getPriorityAging() const = 0;
+
+    // 设置空闲线程的退出超时(ms), 线程空闲超过该时间后退出, 直到线程数降到最小线程数, 0表示不收缩
+    // 退出的线程由其余线程在空闲超时时回收; 最小线程数为0时, 最后退出的线程在下次提交或stop()时回收
+    virtual void setIdleTimeout(uint32_t timeout) = 0;
+
+    // 获取空闲线程的退出超时(ms)
+    [[nodiscard]] virtual uint32_t getIdleTimeout() const = 0;
+
+    // 设置扩容阈值: 空闲线程接不走的排队任务数达到queueDepth, 或最早的排队任务已等待waitTime(ms, 0表示不检查)时增加线程
+    // 工作窃取模式下等待时间按提交所用的注入队列分片计算, 工作线程向本地队列提交时只按排队数判断
+    virtual void setGrowThreshold(size_t queueDepth, uint32_t waitTime) = 0;
+
+    // 获取弹性伸缩统计
+    [[nodiscard]] virtual ThreadPoolScalingStats getScalingStats() const = 0;
+
+    // 获取任务排队等待、执行和端到端耗时的直方图及吞吐量、线程忙碌比例, 各工作线程的统计在读取时合并
+    [[nodiscard]] virtual ThreadPoolStats getStats() const = 0;
+
+    // 清零任务耗时统计
+    virtual void resetStats() = 0;
+
+    // 设置工作线程的CPU亲和性, cpuSet为CPU位掩码(0表示不限制)
+    // pinEach为true时各线程依次轮流绑定到cpuSet中的单个CPU, 否则所有线程都在cpuSet内调度; 对已有和之后创建的线程均生效
+    virtual void setAffinity(OSALCpuSet cpuSet, bool pinEach) = 0;
+
+    // 获取工作线程的CPU集合
+    [[nodiscard]] virtual OSALCpuSet getAffinity() const = 0;
+
+    // 设置空闲工作线程的自旋等待策略, 对已在休眠的线程在下次空闲时生效
+    virtual void setSpinPolicy(const ThreadPoolSpinPolicy &policy) = 0;
+
+    // 获取空闲工作线程的自旋等待策略
+    [[nodiscard]] virtual ThreadPoolSpinPolicy getSpinPolicy() const = 0;
 };
 }  // namespace osal
 #endif  // ITHREAD_POOL_H_
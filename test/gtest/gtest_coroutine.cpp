@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "osal_chrono.h"
+#include "osal_coroutine.h"
+#include "osal_system.h"
+#include "osal_thread.h"
+#include "osal_test_framework_config.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+#if OSAL_CONFIG_COROUTINE
+static OSALTask<int> coroutineAdd(int a, int b) { co_return a + b; }
+
+static OSALTask<int> coroutineSum() {
+    int x = co_await coroutineAdd(1, 2);
+    int y = co_await coroutineAdd(x, 3);
+    co_return y;
+}
+
+static OSALTask<> coroutineOnPool(OSALThreadPool &pool, std::atomic<int> &counter, std::atomic<int> &onWorker) {
+    co_await pool.schedule();
+    if (pool.getActiveThreadCount() > 0) ++onWorker;
+    ++counter;
+}
+
+static OSALTask<int> coroutineAcquire(OSALAsyncSemaphore &semaphore, int value) {
+    co_await semaphore.acquire();
+    co_return value;
+}
+
+static OSALTask<int> coroutineReceive(OSALAsyncMessageQueue<int> &queue, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += co_await queue.receive();
+    }
+    co_return sum;
+}
+
+// A message type without a default constructor
+struct CoroutineMessage {
+    explicit CoroutineMessage(int v) : value(v) {}
+    int value;
+};
+
+static OSALTask<int> coroutineReceiveMessage(OSALAsyncMessageQueue<CoroutineMessage> &queue) {
+    CoroutineMessage message = co_await queue.receive();
+    co_return message.value;
+}
+
+static OSALTask<> coroutineSleep(OSALThreadPool &pool, uint32_t delay, std::atomic<int> &woken) {
+    co_await pool.sleepFor(delay);
+    ++woken;
+}
+#endif
+
+TEST(OSALCoroutineTest, TestOSALCoroutineTask) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineTaskEnabled)
+    // Nested coroutine tasks run in order and return their results
+    ASSERT_EQ(syncWait(coroutineSum()), 6);
+
+    OSALTask<int> task = coroutineAdd(2, 3);
+    ASSERT_TRUE(task.valid());
+    ASSERT_FALSE(task.isDone());  // Lazily started: nothing runs before it is awaited
+    ASSERT_EQ(syncWait(std::move(task)), 5);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALCoroutineTest, TestOSALCoroutineSchedule) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineScheduleEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // Many coroutines hop onto pool worker threads
+    std::atomic<int> counter{0};
+    std::atomic<int> onWorker{0};
+    std::vector<OSALFuture<void>> futures;
+    for (int i = 0; i < 1000; i++) {
+        futures.push_back(spawn(coroutineOnPool(threadPool, counter, onWorker)));
+    }
+    for (auto &future : futures) {
+        ASSERT_TRUE(future.waitFor(1000));
+    }
+    ASSERT_EQ(counter.load(), 1000);
+    ASSERT_EQ(onWorker.load(), 1000);
+
+    // Start a coroutine directly on the pool
+    ASSERT_EQ(spawn(threadPool, coroutineSum()).get(), 6);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALCoroutineTest, TestOSALCoroutineSemaphore) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineSemaphoreEnabled)
+    OSALAsyncSemaphore semaphore(1);
+
+    // No suspension while the count is positive
+    ASSERT_EQ(syncWait(coroutineAcquire(semaphore, 1)), 1);
+    ASSERT_EQ(semaphore.getValue(), 0u);
+
+    // Without a count the coroutine suspends and release() resumes waiters in FIFO order
+    OSALFuture<int> first = spawn(coroutineAcquire(semaphore, 2));
+    OSALFuture<int> second = spawn(coroutineAcquire(semaphore, 3));
+    ASSERT_FALSE(first.isReady());
+    ASSERT_FALSE(second.isReady());
+    semaphore.release();
+    ASSERT_TRUE(first.isReady());
+    ASSERT_FALSE(second.isReady());
+    semaphore.release();
+    ASSERT_EQ(first.get(), 2);
+    ASSERT_EQ(second.get(), 3);
+    ASSERT_EQ(semaphore.getValue(), 0u);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALCoroutineTest, TestOSALCoroutineMessageQueue) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineMessageQueueEnabled)
+    OSALAsyncMessageQueue<int> queue;
+    queue.send(1);
+
+    // Queued messages are taken directly; on an empty queue the coroutine suspends until send() hands it one
+    OSALFuture<int> sum = spawn(coroutineReceive(queue, 3));
+    ASSERT_FALSE(sum.isReady());
+    queue.send(2);
+    ASSERT_FALSE(sum.isReady());
+    queue.send(3);
+    ASSERT_TRUE(sum.isReady());
+    ASSERT_EQ(sum.get(), 6);
+    ASSERT_EQ(queue.size(), 0u);
+
+    // The message type needs no default constructor, whether delivered after suspending or taken directly
+    OSALAsyncMessageQueue<CoroutineMessage> messages;
+    OSALFuture<int> delivered = spawn(coroutineReceiveMessage(messages));
+    ASSERT_FALSE(delivered.isReady());
+    messages.send(CoroutineMessage(4));
+    ASSERT_EQ(delivered.get(), 4);
+    messages.send(CoroutineMessage(5));
+    ASSERT_EQ(spawn(coroutineReceiveMessage(messages)).get(), 5);
+
+    // A sender blocks while the queue is full and is woken once a coroutine takes a message
+    static OSALAsyncMessageQueue<int> bounded(1);
+    static std::atomic<bool> sent;
+    sent = false;
+    bounded.send(10);
+    OSALThread sender;
+    sender.start("AsyncSender", [](void *) {
+        bounded.send(20);
+        sent = true;
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(50);
+    ASSERT_FALSE(sent.load());
+    OSALFuture<int> total = spawn(coroutineReceive(bounded, 2));
+    ASSERT_TRUE(total.waitFor(1000));
+    ASSERT_EQ(total.get(), 30);
+    sender.join();
+    ASSERT_TRUE(sent.load());
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALCoroutineTest, TestOSALCoroutineSleep) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineSleepEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+
+    // A single worker hosts many sleeping coroutines at once
+    std::atomic<int> woken{0};
+    OSALChrono::TimePoint begin = OSALChrono::getInstance().now();
+    std::vector<OSALFuture<void>> futures;
+    for (int i = 0; i < 500; i++) {
+        futures.push_back(spawn(threadPool, coroutineSleep(threadPool, 30, woken)));
+    }
+    for (auto &future : futures) {
+        ASSERT_TRUE(future.waitFor(2000));
+    }
+    uint32_t elapsed = OSALChrono::getInstance().now() - begin;
+    ASSERT_EQ(woken.load(), 500);
+    ASSERT_TRUE(elapsed >= 30);
+    ASSERT_TRUE(elapsed < 2000);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "osal_latch.h"
+#include "osal_parallel.h"
+#include "osal_system.h"
+#include "osal_task_graph.h"
+#include "osal_test_framework_config.h"
+#include "osal_thread.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+TEST(OSALLatchTest, TestOSALLatchCountDown) {
+#if (TestOSALLatchCountDownEnabled)
+    OSALLatch latch(3);
+    ASSERT_FALSE(latch.tryWait());
+    latch.countDown(2);
+    ASSERT_FALSE(latch.waitFor(10));
+
+    // The waiter wakes once another thread performs the final count-down
+    OSALThread thread;
+    thread.start(
+        "LatchThread",
+        [](void *arg) {
+            OSALSystem::getInstance().sleep_ms(20);
+            static_cast<OSALLatch *>(arg)->countDown();
+        },
+        &latch, 0, 1024);
+    ASSERT_TRUE(latch.waitFor(1000));
+    ASSERT_TRUE(latch.tryWait());
+    latch.wait();
+    thread.join();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALParallelTest, TestOSALParallelFor) {
+#if (TestOSALParallelForEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+
+    // Every element is processed exactly once
+    std::vector<std::atomic<int>> hits(1000);
+    parallelFor(threadPool, 0, 1000, 16, [&hits](int i) { hits[i]++; });
+    for (auto &hit : hits) {
+        ASSERT_EQ(hit.load(), 1);
+    }
+
+    // Chunked body with automatic grain
+    std::atomic<int> total{0};
+    parallelFor(threadPool, 0, 1000, 0, [&total](int chunkBegin, int chunkEnd) { total += chunkEnd - chunkBegin; });
+    ASSERT_EQ(total.load(), 1000);
+
+    // An empty range returns immediately
+    parallelFor(threadPool, 5, 5, 1, [&total](int) { total++; });
+    ASSERT_EQ(total.load(), 1000);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALParallelTest, TestOSALParallelReduce) {
+#if (TestOSALParallelReduceEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+
+    int64_t sum = parallelReduce(
+        threadPool, 1, 10001, 64, int64_t{0}, [](int i) { return int64_t{i}; },
+        [](int64_t a, int64_t b) { return a + b; });
+    ASSERT_EQ(sum, 50005000);
+
+    int maximum = parallelReduce(
+        threadPool, 0, 5000, 0, 0, [](int i) { return (i * 37) % 4999; },
+        [](int a, int b) { return a > b ? a : b; });
+    ASSERT_EQ(maximum, 4998);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALParallelTest, TestOSALParallelTransform) {
+#if (TestOSALParallelTransformEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+
+    std::vector<int> input(1000);
+    for (int i = 0; i < 1000; i++) {
+        input[i] = i;
+    }
+    std::vector<int> output(1000, 0);
+    auto end = parallelTransform(threadPool, input.begin(), input.end(), output.begin(), 32,
+                                 [](int value) { return value * 2; });
+    ASSERT_TRUE(end == output.end());
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(output[i], i * 2);
+    }
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALTaskGraphTest, TestOSALTaskGraph) {
+#if (TestOSALTaskGraphEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+
+    // Diamond a -> (b, c) -> d plus an independent chain e -> f
+    static std::atomic<int> sequence;
+    static int order[6];
+    OSALTaskGraph graph;
+    OSALTaskGraph::NodeId nodes[6];
+    for (int i = 0; i < 6; i++) {
+        nodes[i] = graph.addNode([i]() { order[i] = sequence++; });
+    }
+    graph.precede(nodes[0], nodes[1]);
+    graph.precede(nodes[0], nodes[2]);
+    graph.precede(nodes[1], nodes[3]);
+    graph.precede(nodes[2], nodes[3]);
+    graph.precede(nodes[4], nodes[5]);
+    ASSERT_TRUE(graph.isAcyclic());
+
+    // The same graph runs repeatedly
+    for (int round = 0; round < 3; round++) {
+        sequence = 0;
+        ASSERT_TRUE(graph.run(threadPool));
+        ASSERT_EQ(sequence.load(), 6);
+        ASSERT_LT(order[0], order[1]);
+        ASSERT_LT(order[0], order[2]);
+        ASSERT_LT(order[1], order[3]);
+        ASSERT_LT(order[2], order[3]);
+        ASSERT_LT(order[4], order[5]);
+    }
+
+    OSALFuture<void> done = graph.runAsync(threadPool);
+    ASSERT_TRUE(done.waitFor(1000));
+
+    // A graph with a cycle is rejected
+    OSALTaskGraph cyclic;
+    OSALTaskGraph::NodeId first = cyclic.addNode([]() {});
+    OSALTaskGraph::NodeId second = cyclic.addNode([]() {});
+    cyclic.precede(first, second);
+    cyclic.precede(second, first);
+    ASSERT_FALSE(cyclic.isAcyclic());
+    ASSERT_FALSE(cyclic.run(threadPool));
+
+    OSALTaskGraph empty;
+    ASSERT_TRUE(empty.run(threadPool));
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
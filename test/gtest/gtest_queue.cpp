@@ -22,12 +22,80 @@
  * SOFTWARE.
  */
 
+#include <atomic>
+#include <vector>
+
 #include "gtest/gtest.h"
+#include "osal_mpmc_queue.h"
 #include "osal_queue.h"
+#include "osal_spsc_queue.h"
+#include "osal_system.h"
 #include "osal_test_framework_config.h"
+#include "osal_thread.h"
 
 using namespace osal;
 
+namespace {
+// Message that counts its copies; it owns heap data, so copying costs the same as a vector/string message.
+// It has no default constructor, so receiving must not default-construct messages
+struct QueueCopyCounted {
+    static int copies;
+    std::vector<int> payload;
+
+    explicit QueueCopyCounted(size_t size) : payload(size, 1) {}
+    QueueCopyCounted(const QueueCopyCounted &other) : payload(other.payload) { ++copies; }
+    QueueCopyCounted(QueueCopyCounted &&other) noexcept = default;
+    QueueCopyCounted &operator=(const QueueCopyCounted &other) {
+        payload = other.payload;
+        ++copies;
+        return *this;
+    }
+    QueueCopyCounted &operator=(QueueCopyCounted &&other) noexcept = default;
+};
+
+int QueueCopyCounted::copies = 0;
+
+// Sends one lvalue, moves or emplaces the rest, then drains through every receive API;
+// returns the copy count, or -1 when a message arrives with the wrong content
+template <typename Queue>
+int queueCopiesForRoundTrip(Queue &queue) {
+    QueueCopyCounted::copies = 0;
+    MessageQueue<QueueCopyCounted> &messageQueue = queue;
+    QueueCopyCounted message(16);
+    messageQueue.send(message);
+    messageQueue.send(std::move(message));
+    messageQueue.send(QueueCopyCounted(16));
+    queue.emplace(16);
+    QueueCopyCounted received = messageQueue.receive();
+    if (received.payload.size() != 16) return -1;
+    if (!messageQueue.tryReceive(received) || received.payload.size() != 16) return -1;
+    if (!messageQueue.receiveFor(received, 100) || received.payload.size() != 16) return -1;
+    received = messageQueue.receive();
+    if (received.payload.size() != 16) return -1;
+    return QueueCopyCounted::copies;
+}
+
+// Sends 10 messages as one batch, takes them out in two batches, then checks the empty-queue and timeout paths;
+// returns 0 on success, otherwise the failing step
+int queueBatchRoundTrip(MessageQueue<int> &queue) {
+    int messages[10];
+    for (int i = 0; i < 10; i++) {
+        messages[i] = i;
+    }
+    queue.sendBatch(messages);
+    if (queue.size() != 10) return 1;
+    int out[16] = {};
+    if (queue.receiveBatch(out, 4) != 4) return 2;
+    if (queue.receiveBatchFor(out + 4, 12, 100) != 6) return 3;
+    for (int i = 0; i < 10; i++) {
+        if (out[i] != i) return 4;
+    }
+    if (queue.receiveBatch(out, 16) != 0) return 5;
+    if (queue.receiveBatchFor(out, 16, 50) != 0) return 6;
+    return 0;
+}
+}  // namespace
+
 TEST(OSALMessageQueueTest, TestOSALMessageQueueSendReceive) {
 #if (TestOSALMessageQueueSendReceiveEnabled)
     osal::OSALMessageQueue<int> queue;
@@ -89,4 +157,281 @@ TEST(OSALMessageQueueTest, TestOSALMessageQueueClear) {
 #else
     GTEST_SKIP();
 #endif
-}
\ No newline at end of file
+}
+
+TEST(OSALMessageQueueTest, TestOSALMessageQueueMoveSend) {
+#if (TestOSALMessageQueueMoveSendEnabled)
+    // Only the lvalue send copies; moving sends, emplace and every receive move the message
+    osal::OSALMessageQueue<QueueCopyCounted> queue;
+    ASSERT_EQ(queueCopiesForRoundTrip(queue), 1);
+    osal::OSALSpscQueue<QueueCopyCounted, 4> spscQueue;
+    ASSERT_EQ(queueCopiesForRoundTrip(spscQueue), 1);
+    osal::OSALMpmcQueue<QueueCopyCounted, 4> mpmcQueue;
+    ASSERT_EQ(queueCopiesForRoundTrip(mpmcQueue), 1);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALMessageQueueTest, TestOSALMessageQueueBatch) {
+#if (TestOSALMessageQueueBatchEnabled)
+    osal::OSALMessageQueue<int> queue;
+    ASSERT_EQ(queueBatchRoundTrip(queue), 0);
+    osal::OSALSpscQueue<int, 16> spscQueue;
+    ASSERT_EQ(queueBatchRoundTrip(spscQueue), 0);
+    osal::OSALMpmcQueue<int, 16> mpmcQueue;
+    ASSERT_EQ(queueBatchRoundTrip(mpmcQueue), 0);
+
+    // A waiting consumer woken by a batch takes the whole batch at once
+    static osal::OSALMessageQueue<int> pending;
+    static size_t received;
+    received = 0;
+    OSALThread consumer;
+    consumer.start("BatchConsumer", [](void *) {
+        int out[8];
+        received = pending.receiveBatchFor(out, 8, 1000);
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(50);
+    const int batch[] = {1, 2, 3};
+    pending.sendBatch(batch);
+    consumer.join();
+    ASSERT_EQ(received, 3u);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALMessageQueueTest, TestOSALMessageQueueBounded) {
+#if (TestOSALMessageQueueBoundedEnabled)
+    static osal::OSALMessageQueue<std::vector<int>> queue(2);
+    ASSERT_EQ(queue.capacity(), 2u);
+    ASSERT_TRUE(queue.trySend(std::vector<int>(1, 1)));
+    ASSERT_TRUE(queue.sendFor(std::vector<int>(1, 2), 10));
+
+    // trySend and sendFor fail on a full queue and leave the moved-from message intact
+    std::vector<int> message(8, 3);
+    ASSERT_FALSE(queue.trySend(std::move(message)));
+    ASSERT_FALSE(queue.sendFor(std::move(message), 50));
+    ASSERT_EQ(message.size(), 8u);
+    ASSERT_EQ(queue.size(), 2u);
+
+    // send blocks on a full queue until the consumer takes a message
+    static std::atomic<bool> sent;
+    sent = false;
+    OSALThread producer;
+    producer.start("BoundedProducer", [](void *) {
+        queue.send(std::vector<int>(1, 3));
+        sent = true;
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(50);
+    ASSERT_FALSE(sent.load());
+    ASSERT_EQ(queue.receive()[0], 1);
+    producer.join();
+    ASSERT_TRUE(sent.load());
+    ASSERT_EQ(queue.receive()[0], 2);
+    ASSERT_EQ(queue.receive()[0], 3);
+
+    // A batch larger than the capacity waits for free slots chunk by chunk
+    static osal::OSALMessageQueue<int> batchQueue(4);
+    static int sum;
+    sum = 0;
+    OSALThread consumer;
+    consumer.start("BoundedConsumer", [](void *) {
+        int out[4];
+        for (int received = 0; received < 20;) {
+            size_t count = batchQueue.receiveBatchFor(out, 4, 1000);
+            for (size_t i = 0; i < count; i++) {
+                sum += out[i];
+            }
+            received += static_cast<int>(count);
+        }
+    }, nullptr, 0, 1024);
+    int messages[20];
+    for (int i = 0; i < 20; i++) {
+        messages[i] = i;
+    }
+    batchQueue.sendBatch(messages);
+    consumer.join();
+    ASSERT_EQ(sum, 190);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALMessageQueueTest, TestOSALMessageQueuePriority) {
+#if (TestOSALMessageQueuePriorityEnabled)
+    // Higher priorities overtake queued lower ones and each level stays FIFO;
+    // out-of-range priorities map to the top level
+    osal::OSALMessageQueue<int> queue;
+    MessageQueue<int> &messageQueue = queue;
+    messageQueue.send(1);
+    messageQueue.send(2, 0);
+    messageQueue.send(10, 3);
+    messageQueue.send(20, 200);
+    int message = 5;
+    messageQueue.send(message, 1);
+    const int expected[] = {10, 20, 5, 1, 2};
+    for (int value : expected) {
+        ASSERT_EQ(messageQueue.receive(), value);
+    }
+
+    // Batch receive also drains by priority
+    queue.send(7, 0);
+    queue.send(8, 2);
+    int out[2] = {};
+    ASSERT_EQ(queue.receiveBatch(out, 2), 2u);
+    ASSERT_EQ(out[0], 8);
+    ASSERT_EQ(out[1], 7);
+
+    // emplace forwards to the constructor like the standard containers do
+    osal::OSALMessageQueue<std::vector<int>> vectors;
+    vectors.emplace(3, 7);
+    std::vector<int> vector = vectors.receive();
+    ASSERT_EQ(vector.size(), 3u);
+    ASSERT_EQ(vector[0], 7);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALMessageQueueTest, TestOSALSpscQueueSendReceive) {
+#if (TestOSALSpscQueueSendReceiveEnabled)
+    osal::OSALSpscQueue<int, 4> queue;
+    MessageQueue<int> &messageQueue = queue;
+    int message;
+    ASSERT_FALSE(messageQueue.tryReceive(message));
+    ASSERT_FALSE(messageQueue.receiveFor(message, 50));
+
+    // trySend returns false once the capacity is used up
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.trySend(i));
+    }
+    ASSERT_FALSE(queue.trySend(4));
+    ASSERT_EQ(messageQueue.size(), 4);
+
+    ASSERT_EQ(messageQueue.receive(), 0);
+    ASSERT_TRUE(messageQueue.receiveFor(message, 100));
+    ASSERT_EQ(message, 1);
+    ASSERT_TRUE(messageQueue.tryReceive(message));
+    ASSERT_EQ(message, 2);
+    messageQueue.clear();
+    ASSERT_EQ(messageQueue.size(), 0);
+
+    // send with a priority is still available; the lock-free queue ignores the priority
+    queue.send(5, 0);
+    queue.send(6, 2);
+    ASSERT_EQ(queue.receive(), 5);
+    ASSERT_EQ(queue.receive(), 6);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALMessageQueueTest, TestOSALSpscQueueProducerConsumer) {
+#if (TestOSALSpscQueueProducerConsumerEnabled)
+    // Capacity is far below the message count so both sides block; the producer starts late so the consumer waits first
+    static osal::OSALSpscQueue<uint32_t, 8> queue;
+    constexpr uint32_t kMessages = 100000;
+    OSALThread producer;
+    producer.start("SpscProducer", [](void *) {
+        OSALSystem::getInstance().sleep_ms(50);
+        for (uint32_t i = 0; i < kMessages; i++) {
+            queue.send(i);
+        }
+    }, nullptr, 0, 1024);
+
+    // Messages arrive in send order, none lost or duplicated
+    uint32_t message;
+    for (uint32_t i = 0; i < kMessages; i++) {
+        if (i % 2 == 0) {
+            message = queue.receive();
+        } else {
+            ASSERT_TRUE(queue.receiveFor(message, 1000));
+        }
+        ASSERT_EQ(message, i);
+    }
+    producer.join();
+    ASSERT_EQ(queue.size(), 0);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALMessageQueueTest, TestOSALMpmcQueueSendReceive) {
+#if (TestOSALMpmcQueueSendReceiveEnabled)
+    osal::OSALMpmcQueue<int, 4> queue;
+    MessageQueue<int> &messageQueue = queue;
+    int message;
+    ASSERT_FALSE(messageQueue.tryReceive(message));
+    ASSERT_FALSE(messageQueue.receiveFor(message, 50));
+
+    // trySend returns false once the capacity is used up and succeeds again after a receive
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.trySend(i));
+    }
+    ASSERT_FALSE(queue.trySend(4));
+    ASSERT_EQ(messageQueue.size(), 4);
+    ASSERT_EQ(messageQueue.receive(), 0);
+    ASSERT_TRUE(queue.trySend(4));
+
+    ASSERT_TRUE(messageQueue.receiveFor(message, 100));
+    ASSERT_EQ(message, 1);
+    ASSERT_TRUE(messageQueue.tryReceive(message));
+    ASSERT_EQ(message, 2);
+    messageQueue.clear();
+    ASSERT_EQ(messageQueue.size(), 0);
+
+    // send with a priority is still available; the lock-free queue ignores the priority
+    queue.send(5, 0);
+    queue.send(6, 2);
+    ASSERT_EQ(queue.receive(), 5);
+    ASSERT_EQ(queue.receive(), 6);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALMessageQueueTest, TestOSALMpmcQueueMultiProducerConsumer) {
+#if (TestOSALMpmcQueueMultiProducerConsumerEnabled)
+    // Several producers and consumers share a small queue so both sides block
+    static osal::OSALMpmcQueue<uint32_t, 8> queue;
+    static std::atomic<uint64_t> sum;
+    static std::atomic<uint32_t> received;
+    constexpr uint32_t kThreads = 3;
+    constexpr uint32_t kMessages = 20000;
+    sum = 0;
+    received = 0;
+    OSALThread producers[kThreads];
+    OSALThread consumers[kThreads];
+    for (auto &consumer : consumers) {
+        consumer.start("MpmcConsumer", [](void *) {
+            for (uint32_t i = 0; i < kMessages; i++) {
+                sum += queue.receive();
+                ++received;
+            }
+        }, nullptr, 0, 1024);
+    }
+    for (uint32_t p = 0; p < kThreads; p++) {
+        producers[p].start("MpmcProducer", [](void *arg) {
+            auto base = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(arg)) * kMessages;
+            for (uint32_t i = 0; i < kMessages; i++) {
+                queue.send(base + i);
+            }
+        }, reinterpret_cast<void *>(static_cast<uintptr_t>(p)), 0, 1024);
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    for (auto &consumer : consumers) {
+        consumer.join();
+    }
+
+    // Every message is received exactly once
+    constexpr uint64_t kTotal = uint64_t(kThreads) * kMessages;
+    ASSERT_EQ(received.load(), kTotal);
+    ASSERT_EQ(sum.load(), kTotal * (kTotal - 1) / 2);
+    ASSERT_EQ(queue.size(), 0);
+#else
+    GTEST_SKIP();
+#endif
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+
+#include "gtest/gtest.h"
+#include "osal_semaphore.h"
+#include "osal_static_thread_pool.h"
+#include "osal_system.h"
+#include "osal_test_framework_config.h"
+#include "osal_thread.h"
+
+using namespace osal;
+
+TEST(OSALStaticThreadPoolTest, TestOSALStaticThreadPoolOrder) {
+#if (TestOSALStaticThreadPoolOrderEnabled)
+    // The pool lives in static storage; worker stacks and task slots are part of the object
+    static StaticThreadPool<1, 8> threadPool;
+    ASSERT_TRUE(threadPool.start());
+    ASSERT_EQ(threadPool.capacity(), 8u);
+
+    // A single worker runs tasks in submission order; post waits for a free slot when tasks outnumber slots
+    static int order[100];
+    static int next;
+    static OSALSemaphore done;
+    next = 0;
+    for (int i = 0; i < 100; i++) {
+        ThreadPoolSubmitStatus status = threadPool.post([i]() {
+            order[next++] = i;
+            if (i == 99) done.signal();
+        });
+        ASSERT_TRUE(status == ThreadPoolSubmitStatus::Accepted);
+    }
+    ASSERT_TRUE(done.tryWaitFor(1000));
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(order[i], i);
+    }
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALStaticThreadPoolTest, TestOSALStaticThreadPoolBounded) {
+#if (TestOSALStaticThreadPoolBoundedEnabled)
+    static StaticThreadPool<1, 4> threadPool;
+    ASSERT_TRUE(threadPool.start());
+
+    // The worker blocks on the first task, so later tasks stay queued
+    static OSALSemaphore gate;
+    static std::atomic<int> executed;
+    executed = 0;
+    ThreadPoolSubmitStatus status = threadPool.tryPost([]() {
+        gate.wait();
+        ++executed;
+    });
+    ASSERT_TRUE(status == ThreadPoolSubmitStatus::Accepted);
+    for (int i = 0; i < 100 && threadPool.getTaskQueueSize() != 0; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+
+    // tryPost rejects immediately once every slot is taken
+    for (size_t i = 0; i < threadPool.capacity(); i++) {
+        ASSERT_TRUE(threadPool.tryPost([]() { ++executed; }) == ThreadPoolSubmitStatus::Accepted);
+    }
+    ASSERT_TRUE(threadPool.tryPost([]() { ++executed; }) == ThreadPoolSubmitStatus::Rejected);
+    ASSERT_EQ(threadPool.getTaskQueueSize(), 4u);
+
+    // post blocks on a full queue until the worker takes a task
+    static std::atomic<bool> posted;
+    posted = false;
+    OSALThread producer;
+    producer.start("StaticPoolProducer", [](void *) {
+        threadPool.post([]() { ++executed; });
+        posted = true;
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(100);
+    ASSERT_FALSE(posted.load());
+    gate.signal();
+    producer.join();
+    ASSERT_TRUE(posted.load());
+
+    // stop() runs the queued tasks first, later submissions are rejected
+    threadPool.stop();
+    ASSERT_EQ(executed.load(), 6);
+    ASSERT_TRUE(threadPool.tryPost([]() {}) == ThreadPoolSubmitStatus::Rejected);
+    ASSERT_TRUE(threadPool.post([]() {}) == ThreadPoolSubmitStatus::Rejected);
+
+    // The pool can be started again after stop()
+    ASSERT_TRUE(threadPool.start());
+    ASSERT_TRUE(threadPool.post([]() { gate.signal(); }) == ThreadPoolSubmitStatus::Accepted);
+    ASSERT_TRUE(gate.tryWaitFor(1000));
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "osal_strand.h"
+#include "osal_system.h"
+#include "osal_test_framework_config.h"
+#include "osal_thread.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+struct StrandActor {
+    explicit StrandActor(OSALThreadPool &pool) : strand(pool) {}
+
+    OSALStrand strand;
+    int next = 0;  // Only touched inside the strand, no lock
+    bool ordered = true;
+    std::atomic<int> running{0};
+    bool overlapped = false;
+};
+}  // namespace
+
+TEST(OSALStrandTest, TestOSALStrandOrder) {
+#if (TestOSALStrandOrderEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+
+    // Many strands share one pool; each runs its tasks in post order without overlap
+    std::vector<std::unique_ptr<StrandActor>> actors;
+    for (int i = 0; i < 100; i++) {
+        actors.push_back(std::make_unique<StrandActor>(threadPool));
+    }
+    for (int step = 0; step < 100; step++) {
+        for (auto &actor : actors) {
+            StrandActor *self = actor.get();
+            self->strand.post([self, step]() {
+                if (self->running.fetch_add(1) != 0) self->overlapped = true;
+                if (self->next != step) self->ordered = false;
+                self->next = step + 1;
+                self->running.fetch_sub(1);
+            });
+        }
+    }
+    for (auto &actor : actors) {
+        ASSERT_TRUE(actor->strand.submit([]() {}).waitFor(2000));
+        ASSERT_EQ(actor->next, 100);
+        ASSERT_TRUE(actor->ordered);
+        ASSERT_FALSE(actor->overlapped);
+    }
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALStrandTest, TestOSALStrandMultiProducer) {
+#if (TestOSALStrandMultiProducerEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+    OSALStrand strand(threadPool);
+
+    // Concurrent producers; the unlocked counter still ends up exact
+    static int counter;
+    counter = 0;
+    OSALThread producers[3];
+    for (auto &producer : producers) {
+        producer.start("StrandProducer", [&strand](void *) {
+            for (int i = 0; i < 1000; i++) {
+                strand.post([]() { ++counter; });
+            }
+        }, nullptr, 0, 1024);
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    ASSERT_EQ(strand.submit([]() { return counter; }).get(), 3000);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALStrandTest, TestOSALStrandDispatch) {
+#if (TestOSALStrandDispatchEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+    OSALStrand strand(threadPool);
+    ASSERT_FALSE(strand.runningInThisThread());
+
+    // Inside the strand dispatch runs inline while post queues behind the current task
+    static std::atomic<int> order;
+    static int dispatched;
+    static int posted;
+    order = 0;
+    OSALFuture<bool> inside = strand.submit([&strand]() {
+        strand.post([]() { posted = ++order; });
+        strand.dispatch([]() { dispatched = ++order; });
+        return strand.runningInThisThread();
+    });
+    ASSERT_TRUE(inside.get());
+    ASSERT_TRUE(strand.submit([]() {}).waitFor(1000));
+    ASSERT_EQ(dispatched, 1);
+    ASSERT_EQ(posted, 2);
+
+    // Tasks posted while the pool is suspended count as pending
+    threadPool.suspend();
+    OSALStrand idle(threadPool);
+    for (int i = 0; i < 3; i++) {
+        idle.post([]() {});
+    }
+    ASSERT_EQ(idle.pending(), 3u);
+    threadPool.resume();
+    ASSERT_TRUE(idle.submit([]() {}).waitFor(1000));
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+
+#include "gtest/gtest.h"
+#include "osal_task_group.h"
+#include "osal_test_framework_config.h"
+#include "osal_thread_pool.h"
+
+using namespace osal;
+
+namespace {
+// Each level forks two subtasks and waits; far more tasks wait at once than there are threads
+int taskGroupFibonacci(OSALThreadPool &pool, int n) {
+    if (n < 2) return n;
+    int left = 0;
+    int right = 0;
+    OSALTaskGroup group(pool);
+    group.run([&pool, &left, n]() { left = taskGroupFibonacci(pool, n - 1); });
+    group.run([&pool, &right, n]() { right = taskGroupFibonacci(pool, n - 2); });
+    group.wait();
+    return left + right;
+}
+}  // namespace
+
+TEST(OSALTaskGroupTest, TestOSALTaskGroupRunAndWait) {
+#if (TestOSALTaskGroupRunAndWaitEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+    OSALTaskGroup group(threadPool);
+
+    // wait() returns after every subtask finished and the group can be reused
+    std::atomic<int> sum{0};
+    for (int round = 0; round < 2; round++) {
+        for (int i = 1; i <= 100; i++) {
+            group.run([&sum, i]() { sum += i; });
+        }
+        group.wait();
+        ASSERT_EQ(sum.load(), 5050 * (round + 1));
+        ASSERT_EQ(group.pending(), 0u);
+    }
+
+    // Subtasks may add more work to the same group
+    std::atomic<int> nested{0};
+    for (int i = 0; i < 10; i++) {
+        group.run([&group, &nested]() {
+            ++nested;
+            group.run([&nested]() { ++nested; });
+        });
+    }
+    group.wait();
+    ASSERT_EQ(nested.load(), 20);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALTaskGroupTest, TestOSALTaskGroupNestedWait) {
+#if (TestOSALTaskGroupNestedWaitEnabled)
+    // Single worker: a task waiting on its subtasks runs them itself instead of deadlocking
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    OSALFuture<int> outer = threadPool.submit([&threadPool]() {
+        std::atomic<int> sum{0};
+        OSALTaskGroup group(threadPool);
+        for (int i = 0; i < 10; i++) {
+            group.run([&sum]() { ++sum; });
+        }
+        group.wait();
+        return sum.load();
+    });
+    ASSERT_TRUE(outer.waitFor(2000));
+    ASSERT_EQ(outer.get(), 10);
+
+    // Recursive fork-join
+    ASSERT_EQ(threadPool.submit([&threadPool]() { return taskGroupFibonacci(threadPool, 15); }).get(), 610);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
@@ -206,4 +206,32 @@ TEST(OSALThreadTest, TestOSALThreadSuspendAndResume) {
 #else
     GTEST_SKIP();
 #endif
-}
\ No newline at end of file
+}
+TEST(OSALThreadTest, TestOSALThreadAffinity) {
+#if (TestOSALThreadAffinityEnabled)
+    // CPUs are taken from a set in index order, wrapping around
+    EXPECT_EQ(cpuSetCount(0b1010), 2u);
+    EXPECT_EQ(cpuSetNth(0b1010, 0), 1u);
+    EXPECT_EQ(cpuSetNth(0b1010, 1), 3u);
+    EXPECT_EQ(cpuSetNth(0b1010, 2), 1u);
+
+    // Affinity set before start applies when the thread is created
+    OSALThread thread;
+    std::atomic<bool> taskExecuted(false);
+    std::function<void(void *)> taskFunction = [&](void *) {
+        OSALSystem::getInstance().sleep_ms(50);
+        taskExecuted = true;
+    };
+    EXPECT_EQ(thread.setAffinity(cpuSetOf(0)), 0);
+    thread.start("TestThread", taskFunction, nullptr, 0, 1024);
+    EXPECT_EQ(thread.getAffinity(), cpuSetOf(0));
+
+    // Clearing the affinity of a running thread lifts the restriction; both backends then report 0
+    EXPECT_EQ(thread.setAffinity(0), 0);
+    EXPECT_EQ(thread.getAffinity(), 0u);
+    thread.join();
+    EXPECT_TRUE(taskExecuted.load());
+#else
+    GTEST_SKIP();
+#endif
+}
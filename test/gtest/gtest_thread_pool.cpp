@@ -23,12 +23,18 @@
  */
 
 #include <atomic>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "osal_chrono.h"
 #include "osal_system.h"
 #include "osal_test_framework_config.h"
 #include "osal_thread_pool.h"
+#include "osal_thread_pool_group.h"
 
 using namespace osal;
 
@@ -222,4 +228,672 @@ TEST(OSALThreadPoolTests, TestOSALThreadPoolSetMinThreads) {
 #else
     GTEST_SKIP();
 #endif
-}
\ No newline at end of file
+}
+TEST(OSALThreadPoolTests, TestOSALThreadPoolWorkStealing) {
+#if (TestOSALThreadPoolWorkStealingEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.setSchedulingMode(osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    ASSERT_TRUE(threadPool.getSchedulingMode() == osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    threadPool.start(4, 0, 1024);
+
+    // External submissions go to the injection queue, nested submissions to the worker's local deque
+    static std::atomic<int> counter;
+    static osal::OSALThreadPool *pool;
+    counter = 0;
+    pool = &threadPool;
+    auto child = [](void *arg) {
+        (void)arg;
+        ++counter;
+    };
+    auto parent = [child](void *arg) {
+        (void)arg;
+        for (int i = 0; i < 10; i++) {
+            pool->submit(child, nullptr, 0);
+        }
+        ++counter;
+    };
+    for (int i = 0; i < 100; i++) {
+        threadPool.submit(parent, nullptr, 0);
+    }
+    for (int i = 0; i < 200 && counter < 1100; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(counter.load(), 1100);
+    ASSERT_EQ(threadPool.getTaskQueueSize(), 0);
+
+    // Tasks submitted while suspended stay queued and remain visible after stop
+    threadPool.suspend();
+    threadPool.submit(child, nullptr, 0);
+    OSALSystem::getInstance().sleep_ms(50);
+    ASSERT_EQ(threadPool.getTaskQueueSize(), 1);
+    threadPool.stop();
+    ASSERT_EQ(threadPool.getTaskQueueSize(), 1);
+
+    // When full, DropOldest evicts from the worker's local deque and never exceeds the capacity
+    osal::OSALThreadPool stealing;
+    stealing.setSchedulingMode(osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    stealing.start(1, 0, 1024);
+    stealing.setQueueCapacity(2, ThreadPoolOverflowPolicy::DropOldest);
+    static std::atomic<size_t> queuedInTask;
+    counter = 0;
+    pool = &stealing;
+    stealing.post([]() {
+        for (int i = 0; i < 3; i++) {
+            pool->post([]() { ++counter; });
+        }
+        queuedInTask = pool->getTaskQueueSize();
+    });
+    for (int i = 0; i < 200 && counter < 2; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(queuedInTask.load(), 2u);
+    ASSERT_EQ(counter.load(), 2);
+    ASSERT_EQ(stealing.getStats().tasksDropped, 1u);
+    stealing.stop();
+
+    // The pool grows once the oldest queued task has waited longer than growWaitTime
+    osal::OSALThreadPool waiting;
+    waiting.setSchedulingMode(osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    waiting.start(1, 0, 1024);
+    waiting.setMaxThreads(2);
+    waiting.setGrowThreshold(100, 20);
+    static std::atomic<bool> released;
+    released = false;
+    waiting.post([]() {
+        while (!released) {
+            OSALSystem::getInstance().sleep_ms(5);
+        }
+    });
+    waiting.post([]() {});
+    OSALSystem::getInstance().sleep_ms(50);
+    ASSERT_EQ(waiting.getScalingStats().currentThreads, 1u);
+    waiting.post([]() {});
+    ASSERT_EQ(waiting.getScalingStats().currentThreads, 2u);
+    released = true;
+    waiting.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+static std::atomic<int> priorityOrderIndex;
+static int priorityOrder[8];
+
+static void recordPriorityTask(void *arg) { priorityOrder[priorityOrderIndex++] = *static_cast<int *>(arg); }
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolTaskPriority) {
+#if (TestOSALThreadPoolTaskPriorityEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+
+    // Tasks queued while suspended run highest priority first, FIFO within one priority
+    static int low = 0, high = 5;
+    priorityOrderIndex = 0;
+    threadPool.suspend();
+    for (int i = 0; i < 3; i++) {
+        threadPool.submit(recordPriorityTask, &low, 0);
+    }
+    for (int i = 0; i < 3; i++) {
+        threadPool.submit(recordPriorityTask, &high, 5);
+    }
+    threadPool.resume();
+    for (int i = 0; i < 100 && priorityOrderIndex < 6; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(priorityOrderIndex.load(), 6);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(priorityOrder[i], high);
+        ASSERT_EQ(priorityOrder[i + 3], low);
+    }
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolPriorityAging) {
+#if (TestOSALThreadPoolPriorityAgingEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    threadPool.setPriorityAging(10);
+    ASSERT_EQ(threadPool.getPriorityAging(), 10);
+
+    // A low-priority task that waited long enough overtakes a newly submitted high-priority task
+    static int low = 0, high = 5;
+    priorityOrderIndex = 0;
+    threadPool.suspend();
+    threadPool.submit(recordPriorityTask, &low, 0);
+    OSALSystem::getInstance().sleep_ms(100);
+    threadPool.submit(recordPriorityTask, &high, 5);
+    threadPool.resume();
+    for (int i = 0; i < 100 && priorityOrderIndex < 2; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(priorityOrderIndex.load(), 2);
+    ASSERT_EQ(priorityOrder[0], low);
+    ASSERT_EQ(priorityOrder[1], high);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolSubmitCallable) {
+#if (TestOSALThreadPoolSubmitCallableEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // Capturing lambdas are submitted directly; small closures are stored inline without heap allocation
+    std::atomic<int> sum{0};
+    int64_t a = 1, b = 2, c = 3, d = 4, e = 5;
+    auto task = [&sum, a, b, c, d, e]() { sum += static_cast<int>(a + b + c + d + e); };
+    ASSERT_TRUE(OSALTaskFunction<>::isInline<decltype(task)>);
+    for (int i = 0; i < 10; i++) {
+        threadPool.post(task);
+    }
+    threadPool.post([&sum](void *) { sum += 100; }, 1);
+    for (int i = 0; i < 100 && sum < 250; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(sum.load(), 250);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolSubmitFuture) {
+#if (TestOSALThreadPoolSubmitFutureEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // Submit with arguments and fetch the result through the future
+    OSALFuture<int> sum = threadPool.submit([](int a, int b) { return a + b; }, 1, 2);
+    ASSERT_TRUE(sum.valid());
+    ASSERT_TRUE(sum.waitFor(1000));
+    ASSERT_EQ(sum.get(), 3);
+    ASSERT_FALSE(sum.valid());
+
+    // Fan-out/fan-in needs one future per task and no extra sync object
+    OSALFuture<int> squares[16];
+    for (int i = 0; i < 16; i++) {
+        squares[i] = threadPool.submit([i]() { return i * i; });
+    }
+    int total = 0;
+    for (auto &square : squares) {
+        total += square.get();
+    }
+    ASSERT_EQ(total, 1240);
+
+    std::atomic<bool> done{false};
+    OSALFuture<void> task = threadPool.submit([&done]() { done = true; });
+    task.wait();
+    ASSERT_TRUE(task.isReady());
+    ASSERT_TRUE(done.load());
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolFutureThen) {
+#if (TestOSALThreadPoolFutureThenEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // Continuations run in chain order
+    OSALFuture<int> result = threadPool.submit([]() { return 20; })
+                                 .then([](int value) { return value + 1; })
+                                 .then([](int value) { return value * 2; });
+    ASSERT_EQ(result.get(), 42);
+
+    // A continuation attached to a ready future runs immediately
+    OSALPromise<int> promise;
+    OSALFuture<int> ready = promise.getFuture();
+    promise.setValue(5);
+    int seen = 0;
+    OSALFuture<void> next = ready.then([&seen](int value) { seen = value; });
+    ASSERT_TRUE(next.isReady());
+    ASSERT_EQ(seen, 5);
+
+    // A promise destroyed without a value makes the chained future ready without a value
+    OSALFuture<int> broken;
+    {
+        OSALPromise<int> dropped;
+        broken = dropped.getFuture();
+    }
+    OSALFuture<int> chained = broken.then([](int value) { return value; });
+    ASSERT_TRUE(chained.waitFor(100));
+    ASSERT_TRUE(chained.isBroken());
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+static std::atomic<int> batchCounter;
+
+static void batchTask(void *arg) { batchCounter += *static_cast<int *>(arg); }
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolSubmitBatch) {
+#if (TestOSALThreadPoolSubmitBatchEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+
+    // Submit a group of Tasks under a single lock
+    static int one = 1;
+    batchCounter = 0;
+    std::vector<OSALThreadPool::Task> tasks;
+    for (int i = 0; i < 100; i++) {
+        tasks.push_back(OSALThreadPool::Task{batchTask, &one, 0});
+    }
+    threadPool.submitBatch(std::span<OSALThreadPool::Task>(tasks));
+
+    // Callables from an iterator range
+    std::vector<std::function<void()>> callables(50, []() { batchCounter += 2; });
+    threadPool.submitBatch(callables.begin(), callables.end());
+
+    for (int i = 0; i < 100 && batchCounter < 200; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(batchCounter.load(), 200);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolElasticScaling) {
+#if (TestOSALThreadPoolElasticScalingEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    threadPool.setMaxThreads(4);
+    threadPool.setIdleTimeout(50);
+    threadPool.setGrowThreshold(1, 0);
+
+    // Blocked tasks piling up make the pool grow on demand
+    static std::atomic<int> finished;
+    finished = 0;
+    for (int i = 0; i < 4; i++) {
+        threadPool.post([]() {
+            OSALSystem::getInstance().sleep_ms(100);
+            ++finished;
+        });
+    }
+    for (int i = 0; i < 100 && finished < 4; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(finished.load(), 4);
+    ThreadPoolScalingStats stats = threadPool.getScalingStats();
+    ASSERT_GT(stats.peakThreads, 1u);
+
+    // After the idle timeout the pool shrinks back; the next submit reaps exited threads
+    OSALSystem::getInstance().sleep_ms(300);
+    threadPool.post([]() { ++finished; });
+    for (int i = 0; i < 100 && finished < 5; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    stats = threadPool.getScalingStats();
+    ASSERT_EQ(stats.currentThreads, 1u);
+    ASSERT_GE(stats.threadsRetired, 1u);
+    ASSERT_EQ(stats.threadsCreated - stats.threadsRetired, stats.currentThreads);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolStats) {
+#if (TestOSALThreadPoolStatsEnabled)
+    // Power-of-two buckets; a percentile reports the upper bound of its bucket
+    OSALLatencyHistogram histogram;
+    histogram.record(0);
+    histogram.record(1);
+    histogram.record(3);
+    histogram.record(1000);
+    ASSERT_EQ(histogram.count, 4u);
+    ASSERT_EQ(histogram.percentile(0.25), 0u);
+    ASSERT_EQ(histogram.percentile(0.5), 1u);
+    ASSERT_EQ(histogram.percentile(0.75), 3u);
+    ASSERT_EQ(histogram.percentile(1.0), 1000u);
+
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+    threadPool.resetStats();
+
+    static std::atomic<int> finished;
+    finished = 0;
+    for (int i = 0; i < 10; i++) {
+        threadPool.post([]() {
+            OSALSystem::getInstance().sleep_ms(5);
+            ++finished;
+        });
+    }
+    ThreadPoolStats stats = threadPool.getStats();
+    for (int i = 0; i < 100 && stats.tasksCompleted < 10; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+        stats = threadPool.getStats();
+    }
+    ASSERT_EQ(stats.tasksSubmitted, 10u);
+    ASSERT_EQ(stats.tasksCompleted, 10u);
+    ASSERT_EQ(stats.queueWait.count, 10u);
+    ASSERT_EQ(stats.execution.count, 10u);
+    ASSERT_GE(stats.execution.percentile(0.5), 4000u);
+    ASSERT_GE(stats.endToEnd.max, stats.execution.max);
+    ASSERT_GT(stats.throughput, 0);
+    ASSERT_EQ(stats.workers.size(), 2u);
+    ASSERT_GT(stats.busyRatio, 0);
+    ASSERT_LE(stats.busyRatio, 1.0);
+
+    // Reset clears the counters and histograms
+    threadPool.resetStats();
+    stats = threadPool.getStats();
+    ASSERT_EQ(stats.tasksCompleted, 0u);
+    ASSERT_EQ(stats.execution.count, 0u);
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolAffinity) {
+#if (TestOSALThreadPoolAffinityEnabled)
+    // Workers are pinned round-robin over the CPU set, including workers added later
+    osal::OSALThreadPool threadPool;
+    threadPool.setAffinity(cpuSetOf(0), true);
+    ASSERT_EQ(threadPool.start(2, 0, 1024), 0);
+    ASSERT_EQ(threadPool.getScalingStats().currentThreads, 2u);
+    ASSERT_EQ(threadPool.getAffinity(), cpuSetOf(0));
+
+    static std::atomic<int> finished;
+    finished = 0;
+    for (int i = 0; i < 10; i++) {
+        threadPool.post([]() { ++finished; });
+    }
+    for (int i = 0; i < 100 && finished < 10; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(finished.load(), 10);
+    threadPool.stop();
+
+    // One sub-pool per CPU; tasks with the same key go to the same sub-pool
+    OSALThreadPoolGroup group;
+    ASSERT_EQ(group.start(cpuSetOf(0), 2, 0, 1024), 0);
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_EQ(group.affinity(0), cpuSetOf(0));
+    ASSERT_EQ(&group.poolFor(7), &group.pool(0));
+    OSALFuture<int> result = group.submit(7, [](int value) { return value * 2; }, 21);
+    ASSERT_EQ(result.get(), 42);
+    group.stop();
+    ASSERT_EQ(group.size(), 0u);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolCancelHandle) {
+#if (TestOSALThreadPoolCancelHandleEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // Two submissions of the same callable are cancelled independently
+    static std::atomic<int> executed;
+    executed = 0;
+    auto task = []() { ++executed; };
+    threadPool.suspend();
+    OSALTaskHandle first = threadPool.submitCancellable(task);
+    OSALTaskHandle second = threadPool.submitCancellable(task);
+    ASSERT_EQ(first.status(), OSALTaskHandle::Status::Pending);
+    ASSERT_TRUE(threadPool.cancel(first));
+    ASSERT_TRUE(first.isCancelled());
+    threadPool.resume();
+    for (int i = 0; i < 100 && !second.isDone(); i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_TRUE(second.isDone());
+    ASSERT_EQ(executed.load(), 1);
+    ASSERT_FALSE(second.cancel());
+
+    // A running task observes the request through its cancellation token
+    static std::atomic<bool> started;
+    started = false;
+    OSALTaskHandle running = threadPool.submitCancellable([](OSALCancellationToken token) {
+        started = true;
+        for (int i = 0; i < 500 && !token.isCancellationRequested(); i++) {
+            OSALSystem::getInstance().sleep_ms(10);
+        }
+    });
+    for (int i = 0; i < 100 && !started; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_FALSE(running.cancel());
+    for (int i = 0; i < 100 && !running.isDone(); i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_TRUE(running.isDone());
+
+    OSALTaskHandle invalid;
+    ASSERT_FALSE(invalid.cancel());
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolBoundedQueue) {
+#if (TestOSALThreadPoolBoundedQueueEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    threadPool.suspend();
+
+    static std::atomic<int> executed;
+    executed = 0;
+    auto task = []() { ++executed; };
+
+    // A full queue rejects new tasks
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::Reject);
+    ASSERT_EQ(threadPool.getQueueCapacity(), 2u);
+    ASSERT_EQ(threadPool.post(task), ThreadPoolSubmitStatus::Accepted);
+    ASSERT_EQ(threadPool.post(task), ThreadPoolSubmitStatus::Accepted);
+    ASSERT_EQ(threadPool.post(task), ThreadPoolSubmitStatus::Rejected);
+    OSALTaskHandle rejected = threadPool.submitCancellable(task);
+    ASSERT_TRUE(rejected.isCancelled());
+    // A rejected task yields a broken future; get() must not be called on it
+    OSALFuture<int> refused = threadPool.submit([]() { return 1; });
+    ASSERT_TRUE(refused.isBroken());
+    ASSERT_FALSE(refused.hasValue());
+    ASSERT_EQ(threadPool.getTaskQueueSize(), 2u);
+
+    // The submitting thread runs the task itself
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::CallerRuns);
+    ASSERT_EQ(threadPool.post(task), ThreadPoolSubmitStatus::RanInCaller);
+    ASSERT_EQ(executed.load(), 1);
+
+    // The oldest lowest-priority task makes room for the new one
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::DropOldest);
+    ASSERT_EQ(threadPool.post(task, 1), ThreadPoolSubmitStatus::Accepted);
+    ASSERT_EQ(threadPool.getTaskQueueSize(), 2u);
+
+    // Blocking for a free slot times out
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::Block, 50);
+    ASSERT_EQ(threadPool.post(task), ThreadPoolSubmitStatus::Timeout);
+
+    // A blocked submitter wakes up once another thread resumes the pool
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::Block);
+    osal::OSALThreadPool helper;
+    helper.start(1, 0, 1024);
+    helper.post([&threadPool]() {
+        OSALSystem::getInstance().sleep_ms(50);
+        threadPool.resume();
+    });
+    ASSERT_EQ(threadPool.post(task), ThreadPoolSubmitStatus::Accepted);
+    for (int i = 0; i < 100 && executed < 4; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(executed.load(), 4);
+
+    ThreadPoolStats stats = threadPool.getStats();
+    ASSERT_EQ(stats.tasksRejected, 4u);
+    ASSERT_EQ(stats.tasksDropped, 1u);
+    ASSERT_EQ(stats.tasksRanInCaller, 1u);
+    helper.stop();
+    threadPool.stop();
+
+    // Dropped tasks are destroyed after the queue lock is released, so their destructors may post to the same pool
+    osal::OSALThreadPool dropping;
+    dropping.start(1, 0, 1024);
+    dropping.suspend();
+    dropping.setQueueCapacity(1, ThreadPoolOverflowPolicy::DropOldest);
+    std::shared_ptr<void> guard(nullptr, [&dropping](void *) { dropping.post([]() {}); });
+    ASSERT_EQ(dropping.post([guard]() {}), ThreadPoolSubmitStatus::Accepted);
+    guard.reset();
+    ASSERT_EQ(dropping.post([]() {}), ThreadPoolSubmitStatus::Accepted);
+    ASSERT_EQ(dropping.getTaskQueueSize(), 1u);
+    ASSERT_EQ(dropping.getStats().tasksDropped, 2u);
+    dropping.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolDelayedTasks) {
+#if (TestOSALThreadPoolDelayedTasksEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // Delayed tasks run in deadline order, not submission order
+    static std::atomic<int> order;
+    static std::atomic<int> first;
+    static std::atomic<int> second;
+    order = 0;
+    first = 0;
+    second = 0;
+    OSALChrono::TimePoint begin = OSALChrono::getInstance().now();
+    OSALTaskHandle late = threadPool.submitAfter(60, []() { second = ++order; });
+    OSALTaskHandle early = threadPool.submitAt(begin + 30, []() { first = ++order; });
+    ASSERT_EQ(threadPool.getDelayedTaskCount(), 2u);
+    ASSERT_EQ(early.status(), OSALTaskHandle::Status::Pending);
+    for (int i = 0; i < 100 && !late.isDone(); i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_TRUE(late.isDone());
+    ASSERT_GE(OSALChrono::getInstance().now() - begin, 60u);
+    ASSERT_EQ(first.load(), 1);
+    ASSERT_EQ(second.load(), 2);
+
+    // A task cancelled before its deadline never runs
+    static std::atomic<bool> cancelledRan;
+    cancelledRan = false;
+    OSALTaskHandle cancelled = threadPool.submitAfter(50, []() { cancelledRan = true; });
+    ASSERT_TRUE(cancelled.cancel());
+    OSALSystem::getInstance().sleep_ms(100);
+    ASSERT_FALSE(cancelledRan.load());
+    ASSERT_EQ(threadPool.getDelayedTaskCount(), 0u);
+
+    // A periodic task keeps firing until it is cancelled
+    static std::atomic<int> ticks;
+    ticks = 0;
+    OSALTaskHandle periodic = threadPool.submitEvery(10, []() { ++ticks; });
+    for (int i = 0; i < 100 && ticks < 5; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_GE(ticks.load(), 5);
+    periodic.cancel();
+    OSALSystem::getInstance().sleep_ms(30);
+    int stopped = ticks;
+    OSALSystem::getInstance().sleep_ms(50);
+    ASSERT_EQ(ticks.load(), stopped);
+    ASSERT_TRUE(periodic.isCancelled());
+    threadPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolSpinPolicy) {
+#if (TestOSALThreadPoolSpinPolicyEnabled)
+    osal::OSALThreadPool threadPool;
+    ThreadPoolSpinPolicy policy = threadPool.getSpinPolicy();
+    ASSERT_EQ(policy.spinCount, 0u);
+    ASSERT_EQ(policy.hotThreads, 0u);
+
+    // Spin then park: submit one task at a time and wait for it
+    threadPool.setSpinPolicy(ThreadPoolSpinPolicy{2000, 10, 0});
+    policy = threadPool.getSpinPolicy();
+    ASSERT_EQ(policy.spinCount, 2000u);
+    ASSERT_EQ(policy.yieldCount, 10u);
+    threadPool.start(2, 0, 1024);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(threadPool.submit([i]() { return i; }).get(), i);
+    }
+
+    // Hot workers keep spinning; bursts and stop() still work
+    threadPool.setSpinPolicy(ThreadPoolSpinPolicy{100, 1, 1});
+    static std::atomic<int> counter;
+    counter = 0;
+    for (int i = 0; i < 100; i++) {
+        threadPool.post([]() { ++counter; });
+    }
+    for (int i = 0; i < 100 && counter < 100; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    ASSERT_EQ(counter.load(), 100);
+    ASSERT_EQ(threadPool.submit([]() { return 7; }).get(), 7);
+    threadPool.stop();
+    ASSERT_FALSE(threadPool.isStarted());
+
+    // Work-stealing workers spin on the pending task count
+    osal::OSALThreadPool stealingPool;
+    stealingPool.setSchedulingMode(osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    stealingPool.setSpinPolicy(ThreadPoolSpinPolicy{2000, 10, 1});
+    stealingPool.start(2, 0, 1024);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(stealingPool.submit([i]() { return i; }).get(), i);
+    }
+    stealingPool.stop();
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(OSALThreadPoolTests, TestOSALThreadPoolSuspendIdle) {
+#if (TestOSALThreadPoolSuspendIdleEnabled)
+    for (auto mode : {osal::OSALThreadPool::SchedulingMode::SharedQueue,
+                      osal::OSALThreadPool::SchedulingMode::WorkStealing}) {
+        osal::OSALThreadPool threadPool;
+        threadPool.setSchedulingMode(mode);
+        threadPool.start(4, 0, 1024);
+        static std::atomic<int> counter;
+        counter = 0;
+
+        // CPU time used by the rest of the process serves as the baseline
+        std::clock_t baselineBegin = std::clock();
+        OSALSystem::getInstance().sleep_ms(200);
+        std::clock_t baseline = std::clock() - baselineBegin;
+
+        // While suspended, tasks only accumulate and the parked workers burn no CPU
+        threadPool.suspend();
+        OSALSystem::getInstance().sleep_ms(20);
+        for (int i = 0; i < 100; i++) {
+            threadPool.post([]() { ++counter; });
+        }
+        std::clock_t cpuBegin = std::clock();
+        OSALSystem::getInstance().sleep_ms(200);
+        std::clock_t cpuEnd = std::clock();
+        ASSERT_EQ(counter.load(), 0);
+        ASSERT_EQ(threadPool.getTaskQueueSize(), 100u);
+        // Four busy-looping workers would add at least 200 ms of CPU time over the baseline
+        ASSERT_LT((cpuEnd - cpuBegin - baseline) * 1000 / CLOCKS_PER_SEC, 50);
+
+        // Resuming releases every worker and drains the backlog
+        threadPool.resume();
+        for (int i = 0; i < 100 && counter < 100; i++) {
+            OSALSystem::getInstance().sleep_ms(10);
+        }
+        ASSERT_EQ(counter.load(), 100);
+        threadPool.stop();
+    }
+#else
+    GTEST_SKIP();
+#endif
+}
@@ -31,14 +31,19 @@ using namespace osal;
 #ifdef OSAL_CONFIG_SELFTEST_ENABLE
 #include "test_chrono.cpp"  // 如果系统启动时时间为0, 可能会测试失败
 #include "test_condition_variable.cpp"
+#include "test_coroutine.cpp"
 #include "test_framework.h"
 #include "test_lockguard.cpp"
 #include "test_memory_manger.cpp"
 #include "test_mutex.cpp"
+#include "test_parallel.cpp"
 #include "test_queue.cpp"
 #include "test_rwlock.cpp"
 #include "test_semaphore.cpp"
 #include "test_spin_lock.cpp"
+#include "test_static_thread_pool.cpp"
+#include "test_strand.cpp"
+#include "test_task_group.cpp"
 #include "test_thread.cpp"
 #include "test_thread_pool.cpp"
 #include "test_timer.cpp"
@@ -49,13 +54,18 @@ using namespace osal;
 
 #include "gtest_chrono.cpp"  // 如果系统启动时时间为0, 可能会测试失败
 #include "gtest_condition_variable.cpp"
+#include "gtest_coroutine.cpp"
 #include "gtest_lockguard.cpp"
 #include "gtest_memory_manger.cpp"
 #include "gtest_mutex.cpp"
+#include "gtest_parallel.cpp"
 #include "gtest_queue.cpp"
 #include "gtest_rwlock.cpp"
 #include "gtest_semaphore.cpp"
 #include "gtest_spin_lock.cpp"
+#include "gtest_static_thread_pool.cpp"
+#include "gtest_strand.cpp"
+#include "gtest_task_group.cpp"
 #include "gtest_thread.cpp"
 #include "gtest_thread_pool.cpp"
 #include "gtest_timer.cpp"
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+#include <vector>
+
+#include "osal_chrono.h"
+#include "osal_coroutine.h"
+#include "osal_system.h"
+#include "osal_thread.h"
+#include "osal_thread_pool.h"
+#include "test_framework.h"
+
+using namespace osal;
+
+#if OSAL_CONFIG_COROUTINE
+static OSALTask<int> coroutineAdd(int a, int b) { co_return a + b; }
+
+static OSALTask<int> coroutineSum() {
+    int x = co_await coroutineAdd(1, 2);
+    int y = co_await coroutineAdd(x, 3);
+    co_return y;
+}
+
+static OSALTask<> coroutineOnPool(OSALThreadPool &pool, std::atomic<int> &counter, std::atomic<int> &onWorker) {
+    co_await pool.schedule();
+    if (pool.getActiveThreadCount() > 0) ++onWorker;
+    ++counter;
+}
+
+static OSALTask<int> coroutineAcquire(OSALAsyncSemaphore &semaphore, int value) {
+    co_await semaphore.acquire();
+    co_return value;
+}
+
+static OSALTask<int> coroutineReceive(OSALAsyncMessageQueue<int> &queue, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += co_await queue.receive();
+    }
+    co_return sum;
+}
+
+// 没有默认构造函数的消息
+struct CoroutineMessage {
+    explicit CoroutineMessage(int v) : value(v) {}
+    int value;
+};
+
+static OSALTask<int> coroutineReceiveMessage(OSALAsyncMessageQueue<CoroutineMessage> &queue) {
+    CoroutineMessage message = co_await queue.receive();
+    co_return message.value;
+}
+
+static OSALTask<> coroutineSleep(OSALThreadPool &pool, uint32_t delay, std::atomic<int> &woken) {
+    co_await pool.sleepFor(delay);
+    ++woken;
+}
+#endif
+
+TEST_CASE(TestOSALCoroutineTask) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineTaskEnabled)
+    // 嵌套的协程任务按顺序执行并返回结果
+    OSAL_ASSERT_EQ(syncWait(coroutineSum()), 6);
+
+    OSALTask<int> task = coroutineAdd(2, 3);
+    OSAL_ASSERT_TRUE(task.valid());
+    OSAL_ASSERT_FALSE(task.isDone());  // 惰性启动, 被等待之前不执行
+    OSAL_ASSERT_EQ(syncWait(std::move(task)), 5);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALCoroutineSchedule) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineScheduleEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // 大量协程切换到线程池的工作线程上执行
+    std::atomic<int> counter{0};
+    std::atomic<int> onWorker{0};
+    std::vector<OSALFuture<void>> futures;
+    for (int i = 0; i < 1000; i++) {
+        futures.push_back(spawn(coroutineOnPool(threadPool, counter, onWorker)));
+    }
+    for (auto &future : futures) {
+        OSAL_ASSERT_TRUE(future.waitFor(1000));
+    }
+    OSAL_ASSERT_EQ(counter.load(), 1000);
+    OSAL_ASSERT_EQ(onWorker.load(), 1000);
+
+    // 直接在线程池上启动协程
+    OSAL_ASSERT_EQ(spawn(threadPool, coroutineSum()).get(), 6);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALCoroutineSemaphore) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineSemaphoreEnabled)
+    OSALAsyncSemaphore semaphore(1);
+
+    // 有计数时不挂起
+    OSAL_ASSERT_EQ(syncWait(coroutineAcquire(semaphore, 1)), 1);
+    OSAL_ASSERT_EQ(semaphore.getValue(), 0u);
+
+    // 没有计数时挂起, 由release()按等待顺序恢复
+    OSALFuture<int> first = spawn(coroutineAcquire(semaphore, 2));
+    OSALFuture<int> second = spawn(coroutineAcquire(semaphore, 3));
+    OSAL_ASSERT_FALSE(first.isReady());
+    OSAL_ASSERT_FALSE(second.isReady());
+    semaphore.release();
+    OSAL_ASSERT_TRUE(first.isReady());
+    OSAL_ASSERT_FALSE(second.isReady());
+    semaphore.release();
+    OSAL_ASSERT_EQ(first.get(), 2);
+    OSAL_ASSERT_EQ(second.get(), 3);
+    OSAL_ASSERT_EQ(semaphore.getValue(), 0u);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALCoroutineMessageQueue) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineMessageQueueEnabled)
+    OSALAsyncMessageQueue<int> queue;
+    queue.send(1);
+
+    // 已有的消息直接取走, 队列为空时挂起, 由send()交付消息并恢复
+    OSALFuture<int> sum = spawn(coroutineReceive(queue, 3));
+    OSAL_ASSERT_FALSE(sum.isReady());
+    queue.send(2);
+    OSAL_ASSERT_FALSE(sum.isReady());
+    queue.send(3);
+    OSAL_ASSERT_TRUE(sum.isReady());
+    OSAL_ASSERT_EQ(sum.get(), 6);
+    OSAL_ASSERT_EQ(queue.size(), 0u);
+
+    // 消息类型不需要默认构造, 挂起后交付和直接取走均可
+    OSALAsyncMessageQueue<CoroutineMessage> messages;
+    OSALFuture<int> delivered = spawn(coroutineReceiveMessage(messages));
+    OSAL_ASSERT_FALSE(delivered.isReady());
+    messages.send(CoroutineMessage(4));
+    OSAL_ASSERT_EQ(delivered.get(), 4);
+    messages.send(CoroutineMessage(5));
+    OSAL_ASSERT_EQ(spawn(coroutineReceiveMessage(messages)).get(), 5);
+
+    // 队列已满时发送线程阻塞, 协程取走消息后将其唤醒
+    static OSALAsyncMessageQueue<int> bounded(1);
+    static std::atomic<bool> sent;
+    sent = false;
+    bounded.send(10);
+    OSALThread sender;
+    sender.start("AsyncSender", [](void *) {
+        bounded.send(20);
+        sent = true;
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(50);
+    OSAL_ASSERT_FALSE(sent.load());
+    OSALFuture<int> total = spawn(coroutineReceive(bounded, 2));
+    OSAL_ASSERT_TRUE(total.waitFor(1000));
+    OSAL_ASSERT_EQ(total.get(), 30);
+    sender.join();
+    OSAL_ASSERT_TRUE(sent.load());
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALCoroutineSleep) {
+#if OSAL_CONFIG_COROUTINE && (TestOSALCoroutineSleepEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+
+    // 一个工作线程同时承载大量休眠中的协程
+    std::atomic<int> woken{0};
+    OSALChrono::TimePoint begin = OSALChrono::getInstance().now();
+    std::vector<OSALFuture<void>> futures;
+    for (int i = 0; i < 500; i++) {
+        futures.push_back(spawn(threadPool, coroutineSleep(threadPool, 30, woken)));
+    }
+    for (auto &future : futures) {
+        OSAL_ASSERT_TRUE(future.waitFor(2000));
+    }
+    uint32_t elapsed = OSALChrono::getInstance().now() - begin;
+    OSAL_ASSERT_EQ(woken.load(), 500);
+    OSAL_ASSERT_TRUE(elapsed >= 30);
+    OSAL_ASSERT_TRUE(elapsed < 2000);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
@@ -22,11 +22,76 @@
  * SOFTWARE.
  */
 
+#include <atomic>
+#include <vector>
+
+#include "osal_mpmc_queue.h"
 #include "osal_queue.h"
+#include "osal_spsc_queue.h"
+#include "osal_system.h"
+#include "osal_thread.h"
 #include "test_framework.h"
 
 using namespace osal;
 
+namespace {
+// 记录拷贝次数的消息, 持有堆上的数据, 拷贝代价与vector/string类消息相同; 没有默认构造函数, 接收接口不应要求默认构造
+struct QueueCopyCounted {
+    static int copies;
+    std::vector<int> payload;
+
+    explicit QueueCopyCounted(size_t size) : payload(size, 1) {}
+    QueueCopyCounted(const QueueCopyCounted &other) : payload(other.payload) { ++copies; }
+    QueueCopyCounted(QueueCopyCounted &&other) noexcept = default;
+    QueueCopyCounted &operator=(const QueueCopyCounted &other) {
+        payload = other.payload;
+        ++copies;
+        return *this;
+    }
+    QueueCopyCounted &operator=(QueueCopyCounted &&other) noexcept = default;
+};
+
+int QueueCopyCounted::copies = 0;
+
+// 左值发送一次, 其余消息经移动发送或原地构造, 再用各种接收接口取出; 返回拷贝次数, 消息内容错误时返回-1
+template <typename Queue>
+int queueCopiesForRoundTrip(Queue &queue) {
+    QueueCopyCounted::copies = 0;
+    MessageQueue<QueueCopyCounted> &messageQueue = queue;
+    QueueCopyCounted message(16);
+    messageQueue.send(message);
+    messageQueue.send(std::move(message));
+    messageQueue.send(QueueCopyCounted(16));
+    queue.emplace(16);
+    QueueCopyCounted received = messageQueue.receive();
+    if (received.payload.size() != 16) return -1;
+    if (!messageQueue.tryReceive(received) || received.payload.size() != 16) return -1;
+    if (!messageQueue.receiveFor(received, 100) || received.payload.size() != 16) return -1;
+    received = messageQueue.receive();
+    if (received.payload.size() != 16) return -1;
+    return QueueCopyCounted::copies;
+}
+
+// 批量发送10条后分两批取出, 再检查空队列上立即返回和超时返回; 返回0表示通过, 否则为出错的步骤
+int queueBatchRoundTrip(MessageQueue<int> &queue) {
+    int messages[10];
+    for (int i = 0; i < 10; i++) {
+        messages[i] = i;
+    }
+    queue.sendBatch(messages);
+    if (queue.size() != 10) return 1;
+    int out[16] = {};
+    if (queue.receiveBatch(out, 4) != 4) return 2;
+    if (queue.receiveBatchFor(out + 4, 12, 100) != 6) return 3;
+    for (int i = 0; i < 10; i++) {
+        if (out[i] != i) return 4;
+    }
+    if (queue.receiveBatch(out, 16) != 0) return 5;
+    if (queue.receiveBatchFor(out, 16, 50) != 0) return 6;
+    return 0;
+}
+}  // namespace
+
 TEST_CASE(TestOSALMessageQueueSendReceive) {
 #if (TestOSALMessageQueueSendReceiveEnabled)
     osal::OSALMessageQueue<int> queue;
@@ -83,4 +148,271 @@ TEST_CASE(TestOSALMessageQueueClear) {
     OSAL_ASSERT_EQ(queue.size(), 0);
 #endif
     return 0;  // 表示测试通过
-}
\ No newline at end of file
+}
+TEST_CASE(TestOSALMessageQueueMoveSend) {
+#if (TestOSALMessageQueueMoveSendEnabled)
+    // 只有左值发送产生一次拷贝, 移动发送、原地构造和接收都不拷贝消息
+    osal::OSALMessageQueue<QueueCopyCounted> queue;
+    OSAL_ASSERT_EQ(queueCopiesForRoundTrip(queue), 1);
+    osal::OSALSpscQueue<QueueCopyCounted, 4> spscQueue;
+    OSAL_ASSERT_EQ(queueCopiesForRoundTrip(spscQueue), 1);
+    osal::OSALMpmcQueue<QueueCopyCounted, 4> mpmcQueue;
+    OSAL_ASSERT_EQ(queueCopiesForRoundTrip(mpmcQueue), 1);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALMessageQueueBatch) {
+#if (TestOSALMessageQueueBatchEnabled)
+    osal::OSALMessageQueue<int> queue;
+    OSAL_ASSERT_EQ(queueBatchRoundTrip(queue), 0);
+    osal::OSALSpscQueue<int, 16> spscQueue;
+    OSAL_ASSERT_EQ(queueBatchRoundTrip(spscQueue), 0);
+    osal::OSALMpmcQueue<int, 16> mpmcQueue;
+    OSAL_ASSERT_EQ(queueBatchRoundTrip(mpmcQueue), 0);
+
+    // 等待中的消费者被一批消息唤醒后一次取走整批
+    static osal::OSALMessageQueue<int> pending;
+    static size_t received;
+    received = 0;
+    OSALThread consumer;
+    consumer.start("BatchConsumer", [](void *) {
+        int out[8];
+        received = pending.receiveBatchFor(out, 8, 1000);
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(50);
+    const int batch[] = {1, 2, 3};
+    pending.sendBatch(batch);
+    consumer.join();
+    OSAL_ASSERT_EQ(received, 3u);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALMessageQueueBounded) {
+#if (TestOSALMessageQueueBoundedEnabled)
+    static osal::OSALMessageQueue<std::vector<int>> queue(2);
+    OSAL_ASSERT_EQ(queue.capacity(), 2u);
+    OSAL_ASSERT_TRUE(queue.trySend(std::vector<int>(1, 1)));
+    OSAL_ASSERT_TRUE(queue.sendFor(std::vector<int>(1, 2), 10));
+
+    // 队列已满时trySend和sendFor失败, 被移动的消息保持不变
+    std::vector<int> message(8, 3);
+    OSAL_ASSERT_FALSE(queue.trySend(std::move(message)));
+    OSAL_ASSERT_FALSE(queue.sendFor(std::move(message), 50));
+    OSAL_ASSERT_EQ(message.size(), 8u);
+    OSAL_ASSERT_EQ(queue.size(), 2u);
+
+    // send在队列已满时阻塞, 直到消费者取走消息
+    static std::atomic<bool> sent;
+    sent = false;
+    OSALThread producer;
+    producer.start("BoundedProducer", [](void *) {
+        queue.send(std::vector<int>(1, 3));
+        sent = true;
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(50);
+    OSAL_ASSERT_FALSE(sent.load());
+    OSAL_ASSERT_EQ(queue.receive()[0], 1);
+    producer.join();
+    OSAL_ASSERT_TRUE(sent.load());
+    OSAL_ASSERT_EQ(queue.receive()[0], 2);
+    OSAL_ASSERT_EQ(queue.receive()[0], 3);
+
+    // 超过容量的批量发送分段等待空位
+    static osal::OSALMessageQueue<int> batchQueue(4);
+    static int sum;
+    sum = 0;
+    OSALThread consumer;
+    consumer.start("BoundedConsumer", [](void *) {
+        int out[4];
+        for (int received = 0; received < 20;) {
+            size_t count = batchQueue.receiveBatchFor(out, 4, 1000);
+            for (size_t i = 0; i < count; i++) {
+                sum += out[i];
+            }
+            received += static_cast<int>(count);
+        }
+    }, nullptr, 0, 1024);
+    int messages[20];
+    for (int i = 0; i < 20; i++) {
+        messages[i] = i;
+    }
+    batchQueue.sendBatch(messages);
+    consumer.join();
+    OSAL_ASSERT_EQ(sum, 190);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALMessageQueuePriority) {
+#if (TestOSALMessageQueuePriorityEnabled)
+    // 高优先级消息越过已排队的低优先级消息, 同一优先级内先进先出, 超出级数的优先级按最高级处理
+    osal::OSALMessageQueue<int> queue;
+    MessageQueue<int> &messageQueue = queue;
+    messageQueue.send(1);
+    messageQueue.send(2, 0);
+    messageQueue.send(10, 3);
+    messageQueue.send(20, 200);
+    int message = 5;
+    messageQueue.send(message, 1);
+    const int expected[] = {10, 20, 5, 1, 2};
+    for (int value : expected) {
+        OSAL_ASSERT_EQ(messageQueue.receive(), value);
+    }
+
+    // 批量接收同样按优先级取出
+    queue.send(7, 0);
+    queue.send(8, 2);
+    int out[2] = {};
+    OSAL_ASSERT_EQ(queue.receiveBatch(out, 2), 2u);
+    OSAL_ASSERT_EQ(out[0], 8);
+    OSAL_ASSERT_EQ(out[1], 7);
+
+    // emplace的参数按构造函数调用, 与标准容器一致
+    osal::OSALMessageQueue<std::vector<int>> vectors;
+    vectors.emplace(3, 7);
+    std::vector<int> vector = vectors.receive();
+    OSAL_ASSERT_EQ(vector.size(), 3u);
+    OSAL_ASSERT_EQ(vector[0], 7);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALSpscQueueSendReceive) {
+#if (TestOSALSpscQueueSendReceiveEnabled)
+    osal::OSALSpscQueue<int, 4> queue;
+    MessageQueue<int> &messageQueue = queue;
+    int message;
+    OSAL_ASSERT_FALSE(messageQueue.tryReceive(message));
+    OSAL_ASSERT_FALSE(messageQueue.receiveFor(message, 50));
+
+    // 容量用尽后trySend返回false
+    for (int i = 0; i < 4; i++) {
+        OSAL_ASSERT_TRUE(queue.trySend(i));
+    }
+    OSAL_ASSERT_FALSE(queue.trySend(4));
+    OSAL_ASSERT_EQ(messageQueue.size(), 4);
+
+    OSAL_ASSERT_EQ(messageQueue.receive(), 0);
+    OSAL_ASSERT_TRUE(messageQueue.receiveFor(message, 100));
+    OSAL_ASSERT_EQ(message, 1);
+    OSAL_ASSERT_TRUE(messageQueue.tryReceive(message));
+    OSAL_ASSERT_EQ(message, 2);
+    messageQueue.clear();
+    OSAL_ASSERT_EQ(messageQueue.size(), 0);
+
+    // 带优先级的send同样可用, 无锁队列按到达顺序忽略优先级
+    queue.send(5, 0);
+    queue.send(6, 2);
+    OSAL_ASSERT_EQ(queue.receive(), 5);
+    OSAL_ASSERT_EQ(queue.receive(), 6);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALSpscQueueProducerConsumer) {
+#if (TestOSALSpscQueueProducerConsumerEnabled)
+    // 容量远小于消息数, 收发两端都会阻塞; 生产者延迟启动, 消费者先进入等待
+    static osal::OSALSpscQueue<uint32_t, 8> queue;
+    constexpr uint32_t kMessages = 100000;
+    OSALThread producer;
+    producer.start("SpscProducer", [](void *) {
+        OSALSystem::getInstance().sleep_ms(50);
+        for (uint32_t i = 0; i < kMessages; i++) {
+            queue.send(i);
+        }
+    }, nullptr, 0, 1024);
+
+    // 消息按发送顺序到达, 不丢失也不重复
+    uint32_t message;
+    for (uint32_t i = 0; i < kMessages; i++) {
+        if (i % 2 == 0) {
+            message = queue.receive();
+        } else {
+            OSAL_ASSERT_TRUE(queue.receiveFor(message, 1000));
+        }
+        OSAL_ASSERT_EQ(message, i);
+    }
+    producer.join();
+    OSAL_ASSERT_EQ(queue.size(), 0);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALMpmcQueueSendReceive) {
+#if (TestOSALMpmcQueueSendReceiveEnabled)
+    osal::OSALMpmcQueue<int, 4> queue;
+    MessageQueue<int> &messageQueue = queue;
+    int message;
+    OSAL_ASSERT_FALSE(messageQueue.tryReceive(message));
+    OSAL_ASSERT_FALSE(messageQueue.receiveFor(message, 50));
+
+    // 容量用尽后trySend返回false, 取走一条后又可以发送
+    for (int i = 0; i < 4; i++) {
+        OSAL_ASSERT_TRUE(queue.trySend(i));
+    }
+    OSAL_ASSERT_FALSE(queue.trySend(4));
+    OSAL_ASSERT_EQ(messageQueue.size(), 4);
+    OSAL_ASSERT_EQ(messageQueue.receive(), 0);
+    OSAL_ASSERT_TRUE(queue.trySend(4));
+
+    OSAL_ASSERT_TRUE(messageQueue.receiveFor(message, 100));
+    OSAL_ASSERT_EQ(message, 1);
+    OSAL_ASSERT_TRUE(messageQueue.tryReceive(message));
+    OSAL_ASSERT_EQ(message, 2);
+    messageQueue.clear();
+    OSAL_ASSERT_EQ(messageQueue.size(), 0);
+
+    // 带优先级的send同样可用, 无锁队列按到达顺序忽略优先级
+    queue.send(5, 0);
+    queue.send(6, 2);
+    OSAL_ASSERT_EQ(queue.receive(), 5);
+    OSAL_ASSERT_EQ(queue.receive(), 6);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALMpmcQueueMultiProducerConsumer) {
+#if (TestOSALMpmcQueueMultiProducerConsumerEnabled)
+    // 多个生产者和消费者共用一个小容量队列, 收发两端都会阻塞
+    static osal::OSALMpmcQueue<uint32_t, 8> queue;
+    static std::atomic<uint64_t> sum;
+    static std::atomic<uint32_t> received;
+    constexpr uint32_t kThreads = 3;
+    constexpr uint32_t kMessages = 20000;
+    sum = 0;
+    received = 0;
+    OSALThread producers[kThreads];
+    OSALThread consumers[kThreads];
+    for (auto &consumer : consumers) {
+        consumer.start("MpmcConsumer", [](void *) {
+            for (uint32_t i = 0; i < kMessages; i++) {
+                sum += queue.receive();
+                ++received;
+            }
+        }, nullptr, 0, 1024);
+    }
+    for (uint32_t p = 0; p < kThreads; p++) {
+        producers[p].start("MpmcProducer", [](void *arg) {
+            auto base = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(arg)) * kMessages;
+            for (uint32_t i = 0; i < kMessages; i++) {
+                queue.send(base + i);
+            }
+        }, reinterpret_cast<void *>(static_cast<uintptr_t>(p)), 0, 1024);
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    for (auto &consumer : consumers) {
+        consumer.join();
+    }
+
+    // 每条消息恰好被接收一次
+    constexpr uint64_t kTotal = uint64_t(kThreads) * kMessages;
+    OSAL_ASSERT_EQ(received.load(), kTotal);
+    OSAL_ASSERT_EQ(sum.load(), kTotal * (kTotal - 1) / 2);
+    OSAL_ASSERT_EQ(queue.size(), 0);
+#endif
+    return 0;  // 表示测试通过
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/17.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+
+#include "osal_semaphore.h"
+#include "osal_static_thread_pool.h"
+#include "osal_system.h"
+#include "osal_thread.h"
+#include "test_framework.h"
+
+using namespace osal;
+
+TEST_CASE(TestOSALStaticThreadPoolOrder) {
+#if (TestOSALStaticThreadPoolOrderEnabled)
+    // 线程池对象放在静态存储区, 工作线程栈和任务槽位都在对象内
+    static StaticThreadPool<1, 8> threadPool;
+    OSAL_ASSERT_TRUE(threadPool.start());
+    OSAL_ASSERT_EQ(threadPool.capacity(), 8u);
+
+    // 单个工作线程按提交顺序执行, 提交数远多于槽位数时post等待空位
+    static int order[100];
+    static int next;
+    static OSALSemaphore done;
+    next = 0;
+    for (int i = 0; i < 100; i++) {
+        ThreadPoolSubmitStatus status = threadPool.post([i]() {
+            order[next++] = i;
+            if (i == 99) done.signal();
+        });
+        OSAL_ASSERT_TRUE(status == ThreadPoolSubmitStatus::Accepted);
+    }
+    OSAL_ASSERT_TRUE(done.tryWaitFor(1000));
+    for (int i = 0; i < 100; i++) {
+        OSAL_ASSERT_EQ(order[i], i);
+    }
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALStaticThreadPoolBounded) {
+#if (TestOSALStaticThreadPoolBoundedEnabled)
+    static StaticThreadPool<1, 4> threadPool;
+    OSAL_ASSERT_TRUE(threadPool.start());
+
+    // 工作线程阻塞在第一个任务上, 之后的任务只能排队
+    static OSALSemaphore gate;
+    static std::atomic<int> executed;
+    executed = 0;
+    ThreadPoolSubmitStatus status = threadPool.tryPost([]() {
+        gate.wait();
+        ++executed;
+    });
+    OSAL_ASSERT_TRUE(status == ThreadPoolSubmitStatus::Accepted);
+    for (int i = 0; i < 100 && threadPool.getTaskQueueSize() != 0; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+
+    // 槽位占满后tryPost立即拒绝
+    for (size_t i = 0; i < threadPool.capacity(); i++) {
+        OSAL_ASSERT_TRUE(threadPool.tryPost([]() { ++executed; }) == ThreadPoolSubmitStatus::Accepted);
+    }
+    OSAL_ASSERT_TRUE(threadPool.tryPost([]() { ++executed; }) == ThreadPoolSubmitStatus::Rejected);
+    OSAL_ASSERT_EQ(threadPool.getTaskQueueSize(), 4u);
+
+    // 槽位占满后post阻塞, 直到工作线程取走任务
+    static std::atomic<bool> posted;
+    posted = false;
+    OSALThread producer;
+    producer.start("StaticPoolProducer", [](void *) {
+        threadPool.post([]() { ++executed; });
+        posted = true;
+    }, nullptr, 0, 1024);
+    OSALSystem::getInstance().sleep_ms(100);
+    OSAL_ASSERT_FALSE(posted.load());
+    gate.signal();
+    producer.join();
+    OSAL_ASSERT_TRUE(posted.load());
+
+    // stop()先执行完已排队的任务, 之后提交被拒绝
+    threadPool.stop();
+    OSAL_ASSERT_EQ(executed.load(), 6);
+    OSAL_ASSERT_TRUE(threadPool.tryPost([]() {}) == ThreadPoolSubmitStatus::Rejected);
+    OSAL_ASSERT_TRUE(threadPool.post([]() {}) == ThreadPoolSubmitStatus::Rejected);
+
+    // 停止后可以再次启动
+    OSAL_ASSERT_TRUE(threadPool.start());
+    OSAL_ASSERT_TRUE(threadPool.post([]() { gate.signal(); }) == ThreadPoolSubmitStatus::Accepted);
+    OSAL_ASSERT_TRUE(gate.tryWaitFor(1000));
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
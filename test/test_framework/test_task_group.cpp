@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 kamin.deng
+ * Email: kamin.deng@gmail.com
+ * Created on 2026/10/16.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <atomic>
+
+#include "osal_task_group.h"
+#include "osal_thread_pool.h"
+#include "test_framework.h"
+
+using namespace osal;
+
+namespace {
+// 每一层在任务组中分叉出两个子任务并等待, 线程数远少于同时等待的任务数
+int taskGroupFibonacci(OSALThreadPool &pool, int n) {
+    if (n < 2) return n;
+    int left = 0;
+    int right = 0;
+    OSALTaskGroup group(pool);
+    group.run([&pool, &left, n]() { left = taskGroupFibonacci(pool, n - 1); });
+    group.run([&pool, &right, n]() { right = taskGroupFibonacci(pool, n - 2); });
+    group.wait();
+    return left + right;
+}
+}  // namespace
+
+TEST_CASE(TestOSALTaskGroupRunAndWait) {
+#if (TestOSALTaskGroupRunAndWaitEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+    OSALTaskGroup group(threadPool);
+
+    // 等待全部子任务完成, 返回后任务组可以再次使用
+    std::atomic<int> sum{0};
+    for (int round = 0; round < 2; round++) {
+        for (int i = 1; i <= 100; i++) {
+            group.run([&sum, i]() { sum += i; });
+        }
+        group.wait();
+        OSAL_ASSERT_EQ(sum.load(), 5050 * (round + 1));
+        OSAL_ASSERT_EQ(group.pending(), 0u);
+    }
+
+    // 子任务继续向同一组提交
+    std::atomic<int> nested{0};
+    for (int i = 0; i < 10; i++) {
+        group.run([&group, &nested]() {
+            ++nested;
+            group.run([&nested]() { ++nested; });
+        });
+    }
+    group.wait();
+    OSAL_ASSERT_EQ(nested.load(), 20);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALTaskGroupNestedWait) {
+#if (TestOSALTaskGroupNestedWaitEnabled)
+    // 只有一个工作线程: 任务中等待子任务时由该线程自己执行子任务, 不会死锁
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    OSALFuture<int> outer = threadPool.submit([&threadPool]() {
+        std::atomic<int> sum{0};
+        OSALTaskGroup group(threadPool);
+        for (int i = 0; i < 10; i++) {
+            group.run([&sum]() { ++sum; });
+        }
+        group.wait();
+        return sum.load();
+    });
+    OSAL_ASSERT_TRUE(outer.waitFor(2000));
+    OSAL_ASSERT_EQ(outer.get(), 10);
+
+    // 递归分叉合并
+    OSAL_ASSERT_EQ(threadPool.submit([&threadPool]() { return taskGroupFibonacci(threadPool, 15); }).get(), 610);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
@@ -197,4 +197,31 @@ TEST_CASE(TestOSALThreadSuspendAndResume) {
     thread.resume();
 #endif
     return 0;  // 表示测试通过
-}
\ No newline at end of file
+}
+TEST_CASE(TestOSALThreadAffinity) {
+#if (TestOSALThreadAffinityEnabled)
+    // CPU集合按编号轮流取CPU
+    OSAL_ASSERT_EQ(cpuSetCount(0b1010), 2u);
+    OSAL_ASSERT_EQ(cpuSetNth(0b1010, 0), 1u);
+    OSAL_ASSERT_EQ(cpuSetNth(0b1010, 1), 3u);
+    OSAL_ASSERT_EQ(cpuSetNth(0b1010, 2), 1u);
+
+    // 启动前设置的亲和性在线程创建时生效
+    OSALThread thread;
+    std::atomic<bool> taskExecuted(false);
+    std::function<void(void *)> taskFunction = [&](void *) {
+        OSALSystem::getInstance().sleep_ms(50);
+        taskExecuted = true;
+    };
+    OSAL_ASSERT_EQ(thread.setAffinity(cpuSetOf(0)), 0);
+    thread.start("TestThread", taskFunction, nullptr, 0, 1024);
+    OSAL_ASSERT_EQ(thread.getAffinity(), cpuSetOf(0));
+
+    // 运行中恢复为不限制, 不限制时两个后端都返回0
+    OSAL_ASSERT_EQ(thread.setAffinity(0), 0);
+    OSAL_ASSERT_EQ(thread.getAffinity(), 0u);
+    thread.join();
+    OSAL_ASSERT_TRUE(taskExecuted.load());
+#endif
+    return 0;  // 表示测试通过
+}
@@ -23,10 +23,16 @@
  */
 
 #include <atomic>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
 
 #include "osal_chrono.h"
 #include "osal_system.h"
 #include "osal_thread_pool.h"
+#include "osal_thread_pool_group.h"
 #include "test_framework.h"
 
 using namespace osal;
@@ -212,3 +218,643 @@ TEST_CASE(TestOSALThreadPoolSetMinThreads) {
 #endif
     return 0;  // 表示测试通过
 }
+
+TEST_CASE(TestOSALThreadPoolWorkStealing) {
+#if (TestOSALThreadPoolWorkStealingEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.setSchedulingMode(osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    OSAL_ASSERT_TRUE(threadPool.getSchedulingMode() == osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    threadPool.start(4, 0, 1024);
+
+    // 外部提交的任务进入注入队列, 任务内部再提交的子任务进入工作线程的本地队列
+    static std::atomic<int> counter;
+    static osal::OSALThreadPool *pool;
+    counter = 0;
+    pool = &threadPool;
+    auto child = [](void *arg) {
+        (void)arg;
+        ++counter;
+    };
+    auto parent = [child](void *arg) {
+        (void)arg;
+        for (int i = 0; i < 10; i++) {
+            pool->submit(child, nullptr, 0);
+        }
+        ++counter;
+    };
+    for (int i = 0; i < 100; i++) {
+        threadPool.submit(parent, nullptr, 0);
+    }
+    for (int i = 0; i < 200 && counter < 1100; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(counter.load(), 1100);
+    OSAL_ASSERT_EQ(threadPool.getTaskQueueSize(), 0);
+
+    // 暂停后提交的任务保留在队列中, 停止后仍可查询
+    threadPool.suspend();
+    threadPool.submit(child, nullptr, 0);
+    OSALSystem::getInstance().sleep_ms(50);
+    OSAL_ASSERT_EQ(threadPool.getTaskQueueSize(), 1);
+    threadPool.stop();
+    OSAL_ASSERT_EQ(threadPool.getTaskQueueSize(), 1);
+
+    // 队列满时DropOldest从工作线程的本地队列中丢弃任务, 排队数不超出容量
+    osal::OSALThreadPool stealing;
+    stealing.setSchedulingMode(osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    stealing.start(1, 0, 1024);
+    stealing.setQueueCapacity(2, ThreadPoolOverflowPolicy::DropOldest);
+    static std::atomic<size_t> queuedInTask;
+    counter = 0;
+    pool = &stealing;
+    stealing.post([]() {
+        for (int i = 0; i < 3; i++) {
+            pool->post([]() { ++counter; });
+        }
+        queuedInTask = pool->getTaskQueueSize();
+    });
+    for (int i = 0; i < 200 && counter < 2; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(queuedInTask.load(), 2u);
+    OSAL_ASSERT_EQ(counter.load(), 2);
+    OSAL_ASSERT_EQ(stealing.getStats().tasksDropped, 1u);
+    stealing.stop();
+
+    // 最早的排队任务等待超过growWaitTime时扩容
+    osal::OSALThreadPool waiting;
+    waiting.setSchedulingMode(osal::OSALThreadPool::SchedulingMode::WorkStealing);
+    waiting.start(1, 0, 1024);
+    waiting.setMaxThreads(2);
+    waiting.setGrowThreshold(100, 20);
+    static std::atomic<bool> released;
+    released = false;
+    waiting.post([]() {
+        while (!released) {
+            OSALSystem::getInstance().sleep_ms(5);
+        }
+    });
+    waiting.post([]() {});
+    OSALSystem::getInstance().sleep_ms(50);
+    OSAL_ASSERT_EQ(waiting.getScalingStats().currentThreads, 1u);
+    waiting.post([]() {});
+    OSAL_ASSERT_EQ(waiting.getScalingStats().currentThreads, 2u);
+    released = true;
+    waiting.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+static std::atomic<int> priorityOrderIndex;
+static int priorityOrder[8];
+
+static void recordPriorityTask(void *arg) { priorityOrder[priorityOrderIndex++] = *static_cast<int *>(arg); }
+
+TEST_CASE(TestOSALThreadPoolTaskPriority) {
+#if (TestOSALThreadPoolTaskPriorityEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+
+    // 暂停期间提交的任务按优先级从高到低执行, 同优先级按提交顺序执行
+    static int low = 0, high = 5;
+    priorityOrderIndex = 0;
+    threadPool.suspend();
+    for (int i = 0; i < 3; i++) {
+        threadPool.submit(recordPriorityTask, &low, 0);
+    }
+    for (int i = 0; i < 3; i++) {
+        threadPool.submit(recordPriorityTask, &high, 5);
+    }
+    threadPool.resume();
+    for (int i = 0; i < 100 && priorityOrderIndex < 6; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(priorityOrderIndex.load(), 6);
+    for (int i = 0; i < 3; i++) {
+        OSAL_ASSERT_EQ(priorityOrder[i], high);
+        OSAL_ASSERT_EQ(priorityOrder[i + 3], low);
+    }
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolPriorityAging) {
+#if (TestOSALThreadPoolPriorityAgingEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    threadPool.setPriorityAging(10);
+    OSAL_ASSERT_EQ(threadPool.getPriorityAging(), 10);
+
+    // 低优先级任务等待足够久后有效优先级超过新提交的高优先级任务
+    static int low = 0, high = 5;
+    priorityOrderIndex = 0;
+    threadPool.suspend();
+    threadPool.submit(recordPriorityTask, &low, 0);
+    OSALSystem::getInstance().sleep_ms(100);
+    threadPool.submit(recordPriorityTask, &high, 5);
+    threadPool.resume();
+    for (int i = 0; i < 100 && priorityOrderIndex < 2; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(priorityOrderIndex.load(), 2);
+    OSAL_ASSERT_EQ(priorityOrder[0], low);
+    OSAL_ASSERT_EQ(priorityOrder[1], high);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolSubmitCallable) {
+#if (TestOSALThreadPoolSubmitCallableEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // 带捕获的lambda直接提交, 小闭包内联存放不触发堆分配
+    std::atomic<int> sum{0};
+    int64_t a = 1, b = 2, c = 3, d = 4, e = 5;
+    auto task = [&sum, a, b, c, d, e]() { sum += static_cast<int>(a + b + c + d + e); };
+    OSAL_ASSERT_TRUE(OSALTaskFunction<>::isInline<decltype(task)>);
+    for (int i = 0; i < 10; i++) {
+        threadPool.post(task);
+    }
+    threadPool.post([&sum](void *) { sum += 100; }, 1);
+    for (int i = 0; i < 100 && sum < 250; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(sum.load(), 250);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolSubmitFuture) {
+#if (TestOSALThreadPoolSubmitFutureEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // 带参数提交并通过future取回结果
+    OSALFuture<int> sum = threadPool.submit([](int a, int b) { return a + b; }, 1, 2);
+    OSAL_ASSERT_TRUE(sum.valid());
+    OSAL_ASSERT_TRUE(sum.waitFor(1000));
+    OSAL_ASSERT_EQ(sum.get(), 3);
+    OSAL_ASSERT_FALSE(sum.valid());
+
+    // 扇出/扇入: 每个任务只需一个future, 不再额外创建同步对象
+    OSALFuture<int> squares[16];
+    for (int i = 0; i < 16; i++) {
+        squares[i] = threadPool.submit([i]() { return i * i; });
+    }
+    int total = 0;
+    for (auto &square : squares) {
+        total += square.get();
+    }
+    OSAL_ASSERT_EQ(total, 1240);
+
+    std::atomic<bool> done{false};
+    OSALFuture<void> task = threadPool.submit([&done]() { done = true; });
+    task.wait();
+    OSAL_ASSERT_TRUE(task.isReady());
+    OSAL_ASSERT_TRUE(done.load());
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolFutureThen) {
+#if (TestOSALThreadPoolFutureThenEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // 后继任务按链式顺序依次执行
+    OSALFuture<int> result = threadPool.submit([]() { return 20; })
+                                 .then([](int value) { return value + 1; })
+                                 .then([](int value) { return value * 2; });
+    OSAL_ASSERT_EQ(result.get(), 42);
+
+    // 已就绪的future上设置的后继任务立即执行
+    OSALPromise<int> promise;
+    OSALFuture<int> ready = promise.getFuture();
+    promise.setValue(5);
+    int seen = 0;
+    OSALFuture<void> next = ready.then([&seen](int value) { seen = value; });
+    OSAL_ASSERT_TRUE(next.isReady());
+    OSAL_ASSERT_EQ(seen, 5);
+
+    // promise未设置结果就销毁时, 后继future就绪但没有结果
+    OSALFuture<int> broken;
+    {
+        OSALPromise<int> dropped;
+        broken = dropped.getFuture();
+    }
+    OSALFuture<int> chained = broken.then([](int value) { return value; });
+    OSAL_ASSERT_TRUE(chained.waitFor(100));
+    OSAL_ASSERT_TRUE(chained.isBroken());
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+static std::atomic<int> batchCounter;
+
+static void batchTask(void *arg) { batchCounter += *static_cast<int *>(arg); }
+
+TEST_CASE(TestOSALThreadPoolSubmitBatch) {
+#if (TestOSALThreadPoolSubmitBatchEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+
+    // 一次提交一组Task, 只加一次锁
+    static int one = 1;
+    batchCounter = 0;
+    std::vector<OSALThreadPool::Task> tasks;
+    for (int i = 0; i < 100; i++) {
+        tasks.push_back(OSALThreadPool::Task{batchTask, &one, 0});
+    }
+    threadPool.submitBatch(std::span<OSALThreadPool::Task>(tasks));
+
+    // 迭代器范围内的可调用对象
+    std::vector<std::function<void()>> callables(50, []() { batchCounter += 2; });
+    threadPool.submitBatch(callables.begin(), callables.end());
+
+    for (int i = 0; i < 100 && batchCounter < 200; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(batchCounter.load(), 200);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolElasticScaling) {
+#if (TestOSALThreadPoolElasticScalingEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    threadPool.setMaxThreads(4);
+    threadPool.setIdleTimeout(50);
+    threadPool.setGrowThreshold(1, 0);
+
+    // 阻塞任务堆积时按需扩容
+    static std::atomic<int> finished;
+    finished = 0;
+    for (int i = 0; i < 4; i++) {
+        threadPool.post([]() {
+            OSALSystem::getInstance().sleep_ms(100);
+            ++finished;
+        });
+    }
+    for (int i = 0; i < 100 && finished < 4; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(finished.load(), 4);
+    ThreadPoolScalingStats stats = threadPool.getScalingStats();
+    OSAL_ASSERT_TRUE(stats.peakThreads > 1);
+
+    // 空闲超时后收缩回最小线程数, 下一次提交回收已退出的线程
+    OSALSystem::getInstance().sleep_ms(300);
+    threadPool.post([]() { ++finished; });
+    for (int i = 0; i < 100 && finished < 5; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    stats = threadPool.getScalingStats();
+    OSAL_ASSERT_EQ(stats.currentThreads, 1u);
+    OSAL_ASSERT_TRUE(stats.threadsRetired >= 1);
+    OSAL_ASSERT_EQ(stats.threadsCreated - stats.threadsRetired, stats.currentThreads);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolStats) {
+#if (TestOSALThreadPoolStatsEnabled)
+    // 直方图按2的幂分桶, 分位数返回所在桶的上界
+    OSALLatencyHistogram histogram;
+    histogram.record(0);
+    histogram.record(1);
+    histogram.record(3);
+    histogram.record(1000);
+    OSAL_ASSERT_EQ(histogram.count, 4u);
+    OSAL_ASSERT_EQ(histogram.percentile(0.25), 0u);
+    OSAL_ASSERT_EQ(histogram.percentile(0.5), 1u);
+    OSAL_ASSERT_EQ(histogram.percentile(0.75), 3u);
+    OSAL_ASSERT_EQ(histogram.percentile(1.0), 1000u);
+
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+    threadPool.resetStats();
+
+    static std::atomic<int> finished;
+    finished = 0;
+    for (int i = 0; i < 10; i++) {
+        threadPool.post([]() {
+            OSALSystem::getInstance().sleep_ms(5);
+            ++finished;
+        });
+    }
+    ThreadPoolStats stats = threadPool.getStats();
+    for (int i = 0; i < 100 && stats.tasksCompleted < 10; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+        stats = threadPool.getStats();
+    }
+    OSAL_ASSERT_EQ(stats.tasksSubmitted, 10u);
+    OSAL_ASSERT_EQ(stats.tasksCompleted, 10u);
+    OSAL_ASSERT_EQ(stats.queueWait.count, 10u);
+    OSAL_ASSERT_EQ(stats.execution.count, 10u);
+    OSAL_ASSERT_TRUE(stats.execution.percentile(0.5) >= 4000);
+    OSAL_ASSERT_TRUE(stats.endToEnd.max >= stats.execution.max);
+    OSAL_ASSERT_TRUE(stats.throughput > 0);
+    OSAL_ASSERT_EQ(stats.workers.size(), 2u);
+    OSAL_ASSERT_TRUE(stats.busyRatio > 0 && stats.busyRatio <= 1.0);
+
+    threadPool.resetStats();
+    stats = threadPool.getStats();
+    OSAL_ASSERT_EQ(stats.tasksCompleted, 0u);
+    OSAL_ASSERT_EQ(stats.execution.count, 0u);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolAffinity) {
+#if (TestOSALThreadPoolAffinityEnabled)
+    // 工作线程轮流绑定到CPU集合中的单个CPU, 之后扩容的线程同样生效
+    osal::OSALThreadPool threadPool;
+    threadPool.setAffinity(cpuSetOf(0), true);
+    OSAL_ASSERT_EQ(threadPool.start(2, 0, 1024), 0);
+    OSAL_ASSERT_EQ(threadPool.getScalingStats().currentThreads, 2u);
+    OSAL_ASSERT_EQ(threadPool.getAffinity(), cpuSetOf(0));
+
+    static std::atomic<int> finished;
+    finished = 0;
+    for (int i = 0; i < 10; i++) {
+        threadPool.post([]() { ++finished; });
+    }
+    for (int i = 0; i < 100 && finished < 10; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(finished.load(), 10);
+    threadPool.stop();
+
+    // 每个CPU一个子线程池, 相同key的任务进入同一个子池
+    OSALThreadPoolGroup group;
+    OSAL_ASSERT_EQ(group.start(cpuSetOf(0), 2, 0, 1024), 0);
+    OSAL_ASSERT_EQ(group.size(), 1u);
+    OSAL_ASSERT_EQ(group.affinity(0), cpuSetOf(0));
+    OSAL_ASSERT_EQ(&group.poolFor(7), &group.pool(0));
+    OSALFuture<int> result = group.submit(7, [](int value) { return value * 2; }, 21);
+    OSAL_ASSERT_EQ(result.get(), 42);
+    group.stop();
+    OSAL_ASSERT_EQ(group.size(), 0u);
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolCancelHandle) {
+#if (TestOSALThreadPoolCancelHandleEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // 同一个可调用对象的两次提交各自取消, 互不影响
+    static std::atomic<int> executed;
+    executed = 0;
+    auto task = []() { ++executed; };
+    threadPool.suspend();
+    OSALTaskHandle first = threadPool.submitCancellable(task);
+    OSALTaskHandle second = threadPool.submitCancellable(task);
+    OSAL_ASSERT_TRUE(first.status() == OSALTaskHandle::Status::Pending);
+    OSAL_ASSERT_TRUE(threadPool.cancel(first));
+    OSAL_ASSERT_TRUE(first.isCancelled());
+    threadPool.resume();
+    for (int i = 0; i < 100 && !second.isDone(); i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_TRUE(second.isDone());
+    OSAL_ASSERT_EQ(executed.load(), 1);
+    OSAL_ASSERT_FALSE(second.cancel());
+
+    // 正在执行的任务通过取消令牌观察取消请求
+    static std::atomic<bool> started;
+    started = false;
+    OSALTaskHandle running = threadPool.submitCancellable([](OSALCancellationToken token) {
+        started = true;
+        for (int i = 0; i < 500 && !token.isCancellationRequested(); i++) {
+            OSALSystem::getInstance().sleep_ms(10);
+        }
+    });
+    for (int i = 0; i < 100 && !started; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_FALSE(running.cancel());
+    for (int i = 0; i < 100 && !running.isDone(); i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_TRUE(running.isDone());
+
+    OSALTaskHandle invalid;
+    OSAL_ASSERT_FALSE(invalid.cancel());
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolBoundedQueue) {
+#if (TestOSALThreadPoolBoundedQueueEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(1, 0, 1024);
+    threadPool.suspend();
+
+    static std::atomic<int> executed;
+    executed = 0;
+    auto task = []() { ++executed; };
+
+    // 队列满时拒绝
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::Reject);
+    OSAL_ASSERT_EQ(threadPool.getQueueCapacity(), 2u);
+    OSAL_ASSERT_TRUE(threadPool.post(task) == ThreadPoolSubmitStatus::Accepted);
+    OSAL_ASSERT_TRUE(threadPool.post(task) == ThreadPoolSubmitStatus::Accepted);
+    OSAL_ASSERT_TRUE(threadPool.post(task) == ThreadPoolSubmitStatus::Rejected);
+    OSALTaskHandle rejected = threadPool.submitCancellable(task);
+    OSAL_ASSERT_TRUE(rejected.isCancelled());
+    // 被拒绝的任务返回失效的future, 不能调用get()
+    OSALFuture<int> refused = threadPool.submit([]() { return 1; });
+    OSAL_ASSERT_TRUE(refused.isBroken());
+    OSAL_ASSERT_FALSE(refused.hasValue());
+    OSAL_ASSERT_EQ(threadPool.getTaskQueueSize(), 2u);
+
+    // 队列满时在提交线程中执行
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::CallerRuns);
+    OSAL_ASSERT_TRUE(threadPool.post(task) == ThreadPoolSubmitStatus::RanInCaller);
+    OSAL_ASSERT_EQ(executed.load(), 1);
+
+    // 丢弃最早的低优先级任务, 为新任务腾出空位
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::DropOldest);
+    OSAL_ASSERT_TRUE(threadPool.post(task, 1) == ThreadPoolSubmitStatus::Accepted);
+    OSAL_ASSERT_EQ(threadPool.getTaskQueueSize(), 2u);
+
+    // 阻塞等待空位超时
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::Block, 50);
+    OSAL_ASSERT_TRUE(threadPool.post(task) == ThreadPoolSubmitStatus::Timeout);
+
+    // 另一个线程恢复线程池后, 阻塞的提交线程被唤醒
+    threadPool.setQueueCapacity(2, ThreadPoolOverflowPolicy::Block);
+    osal::OSALThreadPool helper;
+    helper.start(1, 0, 1024);
+    helper.post([&threadPool]() {
+        OSALSystem::getInstance().sleep_ms(50);
+        threadPool.resume();
+    });
+    OSAL_ASSERT_TRUE(threadPool.post(task) == ThreadPoolSubmitStatus::Accepted);
+    for (int i = 0; i < 100 && executed < 4; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(executed.load(), 4);
+
+    ThreadPoolStats stats = threadPool.getStats();
+    OSAL_ASSERT_EQ(stats.tasksRejected, 4u);
+    OSAL_ASSERT_EQ(stats.tasksDropped, 1u);
+    OSAL_ASSERT_EQ(stats.tasksRanInCaller, 1u);
+    helper.stop();
+    threadPool.stop();
+
+    // 被丢弃的任务在释放队列锁后销毁, 闭包的析构函数可以再次向同一线程池提交任务
+    osal::OSALThreadPool dropping;
+    dropping.start(1, 0, 1024);
+    dropping.suspend();
+    dropping.setQueueCapacity(1, ThreadPoolOverflowPolicy::DropOldest);
+    std::shared_ptr<void> guard(nullptr, [&dropping](void *) { dropping.post([]() {}); });
+    OSAL_ASSERT_TRUE(dropping.post([guard]() {}) == ThreadPoolSubmitStatus::Accepted);
+    guard.reset();
+    OSAL_ASSERT_TRUE(dropping.post([]() {}) == ThreadPoolSubmitStatus::Accepted);
+    OSAL_ASSERT_EQ(dropping.getTaskQueueSize(), 1u);
+    OSAL_ASSERT_EQ(dropping.getStats().tasksDropped, 2u);
+    dropping.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolDelayedTasks) {
+#if (TestOSALThreadPoolDelayedTasksEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(2, 0, 1024);
+
+    // 延时任务在到期后执行, 到期顺序与提交顺序无关
+    static std::atomic<int> order;
+    static std::atomic<int> first;
+    static std::atomic<int> second;
+    order = 0;
+    first = 0;
+    second = 0;
+    OSALChrono::TimePoint begin = OSALChrono::getInstance().now();
+    OSALTaskHandle late = threadPool.submitAfter(60, []() { second = ++order; });
+    OSALTaskHandle early = threadPool.submitAt(begin + 30, []() { first = ++order; });
+    OSAL_ASSERT_EQ(threadPool.getDelayedTaskCount(), 2u);
+    OSAL_ASSERT_TRUE(early.status() == OSALTaskHandle::Status::Pending);
+    for (int i = 0; i < 100 && !late.isDone(); i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_TRUE(late.isDone());
+    OSAL_ASSERT_TRUE(OSALChrono::getInstance().now() - begin >= 60);
+    OSAL_ASSERT_EQ(first.load(), 1);
+    OSAL_ASSERT_EQ(second.load(), 2);
+
+    // 到期前取消的任务不会执行
+    static std::atomic<bool> cancelledRan;
+    cancelledRan = false;
+    OSALTaskHandle cancelled = threadPool.submitAfter(50, []() { cancelledRan = true; });
+    OSAL_ASSERT_TRUE(cancelled.cancel());
+    OSALSystem::getInstance().sleep_ms(100);
+    OSAL_ASSERT_FALSE(cancelledRan.load());
+    OSAL_ASSERT_EQ(threadPool.getDelayedTaskCount(), 0u);
+
+    // 周期任务反复执行, 取消后不再触发
+    static std::atomic<int> ticks;
+    ticks = 0;
+    OSALTaskHandle periodic = threadPool.submitEvery(10, []() { ++ticks; });
+    for (int i = 0; i < 100 && ticks < 5; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_TRUE(ticks >= 5);
+    periodic.cancel();
+    OSALSystem::getInstance().sleep_ms(30);
+    int stopped = ticks;
+    OSALSystem::getInstance().sleep_ms(50);
+    OSAL_ASSERT_EQ(ticks.load(), stopped);
+    OSAL_ASSERT_TRUE(periodic.isCancelled());
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolSpinPolicy) {
+#if (TestOSALThreadPoolSpinPolicyEnabled)
+    osal::OSALThreadPool threadPool;
+    ThreadPoolSpinPolicy policy = threadPool.getSpinPolicy();
+    OSAL_ASSERT_EQ(policy.spinCount, 0u);
+    OSAL_ASSERT_EQ(policy.hotThreads, 0u);
+
+    // 自旋后休眠: 逐个提交并等待, 每个任务都被自旋或休眠中的线程取走
+    threadPool.setSpinPolicy(ThreadPoolSpinPolicy{2000, 10, 0});
+    policy = threadPool.getSpinPolicy();
+    OSAL_ASSERT_EQ(policy.spinCount, 2000u);
+    OSAL_ASSERT_EQ(policy.yieldCount, 10u);
+    threadPool.start(2, 0, 1024);
+    for (int i = 0; i < 100; i++) {
+        OSAL_ASSERT_EQ(threadPool.submit([i]() { return i; }).get(), i);
+    }
+
+    // 热线程一直自旋, 批量提交和停止均不受影响
+    threadPool.setSpinPolicy(ThreadPoolSpinPolicy{100, 1, 1});
+    static std::atomic<int> counter;
+    counter = 0;
+    for (int i = 0; i < 100; i++) {
+        threadPool.post([]() { ++counter; });
+    }
+    for (int i = 0; i < 100 && counter < 100; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(counter.load(), 100);
+    OSAL_ASSERT_EQ(threadPool.submit([]() { return 7; }).get(), 7);
+    threadPool.stop();
+    OSAL_ASSERT_FALSE(threadPool.isStarted());
+#endif
+    return 0;  // 表示测试通过
+}
+
+TEST_CASE(TestOSALThreadPoolSuspendIdle) {
+#if (TestOSALThreadPoolSuspendIdleEnabled)
+    osal::OSALThreadPool threadPool;
+    threadPool.start(4, 0, 1024);
+    static std::atomic<int> counter;
+    counter = 0;
+
+    // 进程内其他线程的CPU占用作为基线
+    std::clock_t baselineBegin = std::clock();
+    OSALSystem::getInstance().sleep_ms(200);
+    std::clock_t baseline = std::clock() - baselineBegin;
+
+    // 暂停期间任务只在队列中积累, 工作线程休眠不占用CPU
+    threadPool.suspend();
+    OSALSystem::getInstance().sleep_ms(20);
+    for (int i = 0; i < 100; i++) {
+        threadPool.post([]() { ++counter; });
+    }
+    std::clock_t cpuBegin = std::clock();
+    OSALSystem::getInstance().sleep_ms(200);
+    std::clock_t cpuEnd = std::clock();
+    OSAL_ASSERT_EQ(counter.load(), 0);
+    OSAL_ASSERT_EQ(threadPool.getTaskQueueSize(), 100u);
+    if (cpuBegin != static_cast<std::clock_t>(-1)) {
+        // 4个线程忙等时至少多占用200ms的CPU时间, 休眠时与基线相当
+        OSAL_ASSERT_TRUE((cpuEnd - cpuBegin - baseline) * 1000 / CLOCKS_PER_SEC < 50);
+    }
+
+    // 恢复后积累的任务全部执行
+    threadPool.resume();
+    for (int i = 0; i < 100 && counter < 100; i++) {
+        OSALSystem::getInstance().sleep_ms(10);
+    }
+    OSAL_ASSERT_EQ(counter.load(), 100);
+    threadPool.stop();
+#endif
+    return 0;  // 表示测试通过
+}